@@ -0,0 +1,118 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "lena-closest-enb-index.h"
+
+#include "ns3/core-module.h"
+#include "ns3/mobility-module.h"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE("LenaAttachBenchmark");
+
+/**
+ * Setup-time benchmark of the closest-eNB selection done by AttachToClosestEnb.                        AttachToClosestEnb가 수행하는 가장 가까운 eNB 선택의 설정 시간 벤치마크
+ *
+ * For every UE count, the brute-force scan of LteHelper::AttachToClosestEnb()                          UE 수마다 LteHelper::AttachToClosestEnb()의 전수 탐색과
+ * and the ClosestEnbIndex lookup (index construction included) are timed over                          ClosestEnbIndex 탐색(인덱스 생성 포함)의 시간을 같은 무작위 배치에서
+ * the same random deployment, and the selected eNBs are checked to be the same.                        측정하고, 선택된 eNB가 동일한지 검사합니다.
+ * Only the selection is measured: the LTE devices and the attachment itself                            선택 과정만 측정하며, LTE 장치와 연결 자체는 두 방식이 동일합니다.
+ * are the same for both.
+ *
+ * ./ns3 run "lena-attach-benchmark --nEnbs=300 --nUes=10000,50000,100000"
+ */
+int
+main(int argc, char* argv[])
+{
+    uint32_t nEnbs = 300;                                                                               // eNB 수
+    std::string nUesList = "10000,50000,100000";                                                        // 측정할 UE 수 목록
+    double areaSide = 10000;                                                                            // 배치 영역의 한 변 길이 [m]
+
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("nEnbs", "Number of eNBs", nEnbs);                                                     // eNB 수
+    cmd.AddValue("nUes", "Comma-separated list of UE counts", nUesList);                                // 쉼표로 구분된 UE 수 목록
+    cmd.AddValue("areaSide", "Side of the square deployment area [m]", areaSide);                       // 정사각형 배치 영역의 한 변 [m]
+    cmd.Parse(argc, argv);
+
+    Ptr<UniformRandomVariable> coordinate = CreateObject<UniformRandomVariable>();
+    coordinate->SetAttribute("Min", DoubleValue(0));
+    coordinate->SetAttribute("Max", DoubleValue(areaSide));
+
+    std::vector<Vector> enbPositions;
+    for (uint32_t i = 0; i < nEnbs; ++i)
+    {
+        double x = coordinate->GetValue();
+        double y = coordinate->GetValue();
+        enbPositions.emplace_back(x, y, 30.0);
+    }
+
+    std::istringstream nUesStream(nUesList);
+    std::string token;
+    while (std::getline(nUesStream, token, ','))
+    {
+        uint32_t nUes = std::stoul(token);
+        std::vector<Vector> uePositions;
+        uePositions.reserve(nUes);
+        for (uint32_t u = 0; u < nUes; ++u)
+        {
+            double x = coordinate->GetValue();
+            double y = coordinate->GetValue();
+            uePositions.emplace_back(x, y, 1.5);
+        }
+
+        // brute force, as in LteHelper::AttachToClosestEnb()                                           LteHelper::AttachToClosestEnb()와 같은 전수 탐색
+        std::vector<uint32_t> bruteForce(nUes);
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t u = 0; u < nUes; ++u)
+        {
+            double minDistance = std::numeric_limits<double>::infinity();
+            for (uint32_t i = 0; i < nEnbs; ++i)
+            {
+                double distance = CalculateDistance(uePositions[u], enbPositions[i]);
+                if (distance < minDistance)
+                {
+                    minDistance = distance;
+                    bruteForce[u] = i;
+                }
+            }
+        }
+        std::chrono::duration<double> bruteForceTime = std::chrono::steady_clock::now() - start;
+
+        std::vector<uint32_t> indexed(nUes);
+        start = std::chrono::steady_clock::now();
+        ClosestEnbIndex index(enbPositions);
+        for (uint32_t u = 0; u < nUes; ++u)
+        {
+            indexed[u] = index.FindClosest(uePositions[u]);
+        }
+        std::chrono::duration<double> indexedTime = std::chrono::steady_clock::now() - start;
+
+        NS_ABORT_MSG_IF(bruteForce != indexed,
+                        "the indexed lookup selected a different eNB than the brute-force scan");
+        std::cout << std::fixed << std::setprecision(4) << "eNBs " << nEnbs << ", UEs " << nUes
+                  << ": brute force " << bruteForceTime.count() << " s, indexed "
+                  << indexedTime.count() << " s, speedup " << std::setprecision(1)
+                  << bruteForceTime.count() / indexedTime.count() << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,71 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef LENA_BATCH_RUNS_H
+#define LENA_BATCH_RUNS_H
+
+#include <ns3/abort.h>
+#include <ns3/ipv4-address-generator.h>
+#include <ns3/ipv6-address-generator.h>
+#include <ns3/rng-seed-manager.h>
+#include <ns3/simulator.h>
+
+#include <cstdint>
+#include <functional>
+
+namespace ns3
+{
+
+/**
+ * Run a simulation for several consecutive RngRun values, one after the other in one process.          연속된 여러 RngRun 값에 대해 하나의 프로세스에서 차례로 시뮬레이션을 실행합니다.
+ *
+ * The runs start from the current RngRun (e.g., set with --RngRun or                                   실행은 현재 RngRun(예: --RngRun 또는 RngSeedManager::SetRun()으로 설정)부터
+ * RngSeedManager::SetRun()). Before each run, the run number is set and the                            시작합니다. 각 실행 전에 실행 번호를 설정하고 자동 스트림 인덱스와
+ * automatic stream index and the IPv4 and IPv6 address pools are reset (the                            IPv4 및 IPv6 주소 풀을 초기화합니다(MAC 주소 할당은
+ * MAC address allocation is reset by Simulator::Destroy()), so that a run starts                       Simulator::Destroy()가 초기화합니다). 따라서 각 실행은 같은 RngRun으로
+ * from the state of a separate process started with the same RngRun; after                             시작한 별도 프로세스의 상태에서 시작합니다. 각 실행 후에는
+ * each run, Simulator::Destroy() disposes of the nodes, channels and buildings.                        Simulator::Destroy()가 노드, 채널, 건물을 해제합니다.
+ *
+ * Only the start-up of a process is saved: loading the libraries, registering                          절약되는 것은 프로세스 시작 비용뿐입니다: 라이브러리 로드, TypeId 등록,
+ * the TypeIds, parsing the options and the ConfigStore input, and loading                              옵션과 ConfigStore 입력 파싱, 그리고 공유 페이딩 트레이스(MappedFadingTrace)
+ * process-wide caches such as the shared fading traces (MappedFadingTrace).                            같은 프로세스 전체 캐시의 로드입니다. 노드, 건물, eNB 배치와 그에 캐시된
+ * The scenario itself, i.e. the nodes, the buildings, the eNB layout and the                           경로손실 등 시나리오 자체는 runOnce가 매 실행마다 다시 만듭니다.
+ * pathloss cached on them, is built again by runOnce for every run.                                    다른 전역 상태를 사용하는 예제에 적용할 때는, 두 번째 실행의 출력이
+ * When using it in an example relying on other global state, check that the                            같은 RngRun의 단일 실행 출력과 같은지 확인하십시오. 예:
+ * output of the second run matches the one of a single run with the same
+ * RngRun, e.g. --nRuns=2 against --RngRun=2 --nRuns=1.
+ *
+ * \param nRuns the number of runs                                                                      실행 횟수
+ * \param runOnce sets up and runs one simulation; it gets the run number                               하나의 시뮬레이션을 구성하고 실행합니다. 실행 번호를 인자로 받습니다.
+ */
+inline void
+RunBatch(uint32_t nRuns, const std::function<void(uint64_t run)>& runOnce)
+{
+    NS_ABORT_MSG_IF(nRuns == 0, "at least one run is needed");
+    uint64_t firstRun = RngSeedManager::GetRun();
+    for (uint64_t run = firstRun; run < firstRun + nRuns; ++run)
+    {
+        RngSeedManager::SetRun(run);
+        RngSeedManager::ResetNextStreamIndex();
+        Ipv4AddressGenerator::Reset();
+        Ipv6AddressGenerator::Reset();
+        runOnce(run);
+        Simulator::Destroy();
+    }
+}
+
+} // namespace ns3
+
+#endif // LENA_BATCH_RUNS_H
@@ -0,0 +1,174 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef LENA_BINARY_RECORD_WRITER_H
+#define LENA_BINARY_RECORD_WRITER_H
+
+#include <ns3/abort.h>
+#include <ns3/assert.h>
+
+#include <condition_variable>
+#include <cstddef>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * Writer of fixed-size binary records, with the file writes done by a background thread.               고정 크기 이진 레코드를 기록하며, 파일 쓰기는 백그라운드 스레드가 수행합니다.
+ *
+ * The simulation appends records to a front buffer; when it is full, the buffer is                     시뮬레이션은 앞쪽 버퍼에 레코드를 추가하고, 버퍼가 가득 차면
+ * swapped with the back buffer, which the writer thread dumps to the file with a                       뒤쪽 버퍼와 교체하며, 쓰기 스레드가 뒤쪽 버퍼를 한 번의 write()로
+ * single write(). The simulation only waits if the writer is still busy with the                       파일에 기록합니다. 쓰기 스레드가 이전 버퍼를 아직 기록 중일 때만
+ * previous buffer. Records are written as they are in memory, hence the file can                       시뮬레이션이 대기합니다. 레코드는 메모리 표현 그대로 기록되므로
+ * only be read back on a machine with the same endianness.                                             같은 엔디언의 머신에서만 다시 읽을 수 있습니다.
+ *
+ * \tparam Record the record type, trivially copyable                                                   레코드 타입 (trivially copyable)
+ */
+template <class Record>
+class BinaryRecordWriter
+{
+    static_assert(std::is_trivially_copyable<Record>::value,
+                  "records are written with their memory representation");
+
+  public:
+    BinaryRecordWriter() = default;
+
+    ~BinaryRecordWriter()
+    {
+        Close();
+    }
+
+    BinaryRecordWriter(const BinaryRecordWriter&) = delete;
+    BinaryRecordWriter& operator=(const BinaryRecordWriter&) = delete;
+
+    /**
+     * Open the file, write its header and start the writer thread.                                     파일을 열고 헤더를 기록한 뒤 쓰기 스레드를 시작합니다.
+     *
+     * \param fileName the output file name                                                             출력 파일 이름
+     * \param header the file header, written as it is in memory                                        메모리 표현 그대로 기록되는 파일 헤더
+     * \param bufferRecords the number of records per buffer                                            버퍼당 레코드 수
+     */
+    template <class Header>
+    void Open(const std::string& fileName, const Header& header, std::size_t bufferRecords = 65536)
+    {
+        static_assert(std::is_trivially_copyable<Header>::value,
+                      "the header is written with its memory representation");
+        NS_ABORT_MSG_IF(m_open, "writer already open");
+        NS_ABORT_MSG_IF(bufferRecords == 0, "the buffer must hold at least one record");
+        m_file.open(fileName, std::ios::out | std::ios::binary | std::ios::trunc);
+        NS_ABORT_MSG_IF(!m_file.is_open(), "Can't open file " << fileName);
+        m_file.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+        m_capacity = bufferRecords;
+        m_front.reserve(m_capacity);
+        m_back.reserve(m_capacity);
+        m_stop = false;
+        m_open = true;
+        m_thread = std::thread(&BinaryRecordWriter::Run, this);
+    }
+
+    /**
+     * \return true if the writer is open                                                               쓰기 객체가 열려 있으면 참
+     */
+    bool IsOpen() const
+    {
+        return m_open;
+    }
+
+    /**
+     * Append a record.                                                                                 레코드를 추가합니다.
+     * \param record the record                                                                         레코드
+     */
+    void Write(const Record& record)
+    {
+        NS_ASSERT(m_open);
+        m_front.push_back(record);
+        if (m_front.size() == m_capacity)
+        {
+            HandOver();
+        }
+    }
+
+    /**
+     * Write the pending records, stop the writer thread and close the file.                            남은 레코드를 기록하고 쓰기 스레드를 멈춘 뒤 파일을 닫습니다.
+     */
+    void Close()
+    {
+        if (!m_open)
+        {
+            return;
+        }
+        HandOver();
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_cv.notify_all();
+        m_thread.join();
+        m_file.close();
+        m_open = false;
+    }
+
+  private:
+    /// Give the front buffer to the writer thread, once it is done with the previous one               쓰기 스레드가 이전 버퍼를 마치면 앞쪽 버퍼를 넘겨줍니다.
+    void HandOver()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cv.wait(lock, [this] { return m_back.empty(); });
+        m_front.swap(m_back);
+        lock.unlock();
+        m_cv.notify_all();
+    }
+
+    /// Body of the writer thread                                                                       쓰기 스레드의 본체
+    void Run()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        while (true)
+        {
+            m_cv.wait(lock, [this] { return !m_back.empty() || m_stop; });
+            if (m_back.empty())
+            {
+                break;
+            }
+            // the simulation thread does not touch the back buffer until it is empty                   시뮬레이션 스레드는 뒤쪽 버퍼가 빌 때까지 접근하지 않습니다.
+            lock.unlock();
+            m_file.write(reinterpret_cast<const char*>(m_back.data()),
+                         m_back.size() * sizeof(Record));
+            lock.lock();
+            m_back.clear();
+            m_cv.notify_all();
+        }
+    }
+
+    std::ofstream m_file;         ///< output file
+    std::vector<Record> m_front;  ///< buffer filled by the simulation
+    std::vector<Record> m_back;   ///< buffer written by the writer thread
+    std::size_t m_capacity{0};    ///< records per buffer
+    std::thread m_thread;         ///< writer thread
+    std::mutex m_mutex;           ///< protects m_back and m_stop
+    std::condition_variable m_cv; ///< signals changes of m_back and m_stop
+    bool m_stop{false};           ///< asks the writer thread to terminate
+    bool m_open{false};           ///< true between Open() and Close()
+};
+
+} // namespace ns3
+
+#endif // LENA_BINARY_RECORD_WRITER_H
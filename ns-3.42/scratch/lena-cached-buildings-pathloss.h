@@ -0,0 +1,197 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef LENA_CACHED_BUILDINGS_PATHLOSS_H
+#define LENA_CACHED_BUILDINGS_PATHLOSS_H
+
+#include <ns3/abort.h>
+#include <ns3/callback.h>
+#include <ns3/hybrid-buildings-propagation-loss-model.h>
+#include <ns3/mobility-model.h>
+#include <ns3/object.h>
+#include <ns3/trace-source-accessor.h>
+#include <ns3/traced-value.h>
+
+#include <cstdint>
+#include <map>
+#include <utility>
+
+namespace ns3
+{
+
+/**
+ * HybridBuildingsPropagationLossModel with a cache of the loss of each link.                           각 링크의 손실을 캐시하는 HybridBuildingsPropagationLossModel
+ *
+ * The loss (indoor/outdoor classification, wall penetration, ITU-R P.1411,                             손실(실내/실외 분류, 벽 투과, ITU-R P.1411, ITU-R P.1238,
+ * ITU-R P.1238, Okumura-Hata or Kun 2600 MHz) only depends on the positions of                         Okumura-Hata 또는 Kun 2600 MHz)은 두 노드의 위치에만 의존하므로,
+ * the two nodes, hence it is computed once per (tx, rx) mobility pair and reused                       (송신, 수신) 이동성 모델 쌍마다 한 번 계산하여 어느 노드도 움직이지 않는
+ * as long as neither node moves. Each mobility model has a position epoch,                             동안 재사용합니다. 각 이동성 모델은 위치 에포크를 가지며, 이는
+ * incremented by its CourseChange notifications; an entry is valid if it was                           CourseChange 알림마다 증가합니다. 항목은 두 모델의 현재 에포크에서
+ * computed at the current epochs of both models. Nodes with a non-zero velocity                        계산된 경우에만 유효합니다. 속도가 0이 아닌 노드는 알림 없이 움직이므로
+ * move without notifications, so their links are never cached. The shadowing is                        그 링크는 캐시하지 않습니다. 섀도잉은 이미 BuildingsPropagationLossModel이
+ * already stored per link by BuildingsPropagationLossModel and is not affected.                        링크별로 저장하므로 영향을 받지 않습니다.
+ */
+class CachedHybridBuildingsPropagationLossModel : public HybridBuildingsPropagationLossModel
+{
+  public:
+    /**
+     * \brief Get the type ID.                                                                          타입 ID를 가져옵니다.
+     * \return the object TypeId                                                                        객체 TypeId
+     */
+    static TypeId GetTypeId()
+    {
+        static TypeId tid =
+            TypeId("ns3::CachedHybridBuildingsPropagationLossModel")
+                .SetParent<HybridBuildingsPropagationLossModel>()
+                .SetGroupName("Buildings")
+                .AddConstructor<CachedHybridBuildingsPropagationLossModel>()
+                .AddTraceSource("Hits",
+                                "Number of losses taken from the cache",
+                                MakeTraceSourceAccessor(
+                                    &CachedHybridBuildingsPropagationLossModel::m_hits),
+                                "ns3::TracedValueCallback::Uint64")
+                .AddTraceSource("Misses",
+                                "Number of losses computed by the model",
+                                MakeTraceSourceAccessor(
+                                    &CachedHybridBuildingsPropagationLossModel::m_misses),
+                                "ns3::TracedValueCallback::Uint64");
+        return tid;
+    }
+
+    /**
+     * \return the number of losses taken from the cache                                                캐시에서 가져온 손실의 수
+     */
+    uint64_t GetHits() const
+    {
+        return m_hits;
+    }
+
+    /**
+     * \return the number of losses computed by the model                                               모델이 계산한 손실의 수
+     */
+    uint64_t GetMisses() const
+    {
+        return m_misses;
+    }
+
+    /**
+     * \param a the mobility model of the source                                                        송신 측 이동성 모델
+     * \param b the mobility model of the destination                                                   수신 측 이동성 모델
+     * \return the propagation loss [dB]                                                                전파 손실 [dB]
+     */
+    double GetLoss(Ptr<MobilityModel> a, Ptr<MobilityModel> b) const override
+    {
+        if (a->GetVelocity().GetLength() > 0 || b->GetVelocity().GetLength() > 0)
+        {
+            ++m_misses;
+            return HybridBuildingsPropagationLossModel::GetLoss(a, b);
+        }
+        uint32_t epochA = GetEpoch(a);
+        uint32_t epochB = GetEpoch(b);
+        auto it = m_cache.find(std::make_pair(a, b));
+        if (it != m_cache.end() && it->second.epochA == epochA && it->second.epochB == epochB)
+        {
+            ++m_hits;
+            return it->second.loss;
+        }
+        ++m_misses;
+        if (it == m_cache.end())
+        {
+            it = m_cache.emplace(std::make_pair(a, b), CacheEntry()).first;
+        }
+        it->second.loss = HybridBuildingsPropagationLossModel::GetLoss(a, b);
+        it->second.epochA = epochA;
+        it->second.epochB = epochB;
+        return it->second.loss;
+    }
+
+  protected:
+    void DoDispose() override
+    {
+        for (auto& epoch : m_epochs)
+        {
+            NS_ABORT_MSG_IF(
+                !epoch.first->TraceDisconnectWithoutContext("CourseChange", GetCourseChangeSink()),
+                "no CourseChange trace source to disconnect from");
+        }
+        m_epochs.clear();
+        m_cache.clear();
+        HybridBuildingsPropagationLossModel::DoDispose();
+    }
+
+  private:
+    /// Cached loss of a link                                                                           링크의 캐시된 손실
+    struct CacheEntry
+    {
+        double loss;     ///< loss [dB]
+        uint32_t epochA; ///< position epoch of the source
+        uint32_t epochB; ///< position epoch of the destination
+    };
+
+    /**
+     * Get the position epoch of a mobility model, starting to follow its course                        이동성 모델의 위치 에포크를 가져옵니다. 처음 보는 모델이면
+     * changes the first time it is seen.                                                               경로 변경을 추적하기 시작합니다.
+     *
+     * \param model the mobility model                                                                  이동성 모델
+     * \return the position epoch                                                                       위치 에포크
+     */
+    uint32_t GetEpoch(Ptr<MobilityModel> model) const
+    {
+        auto it = m_epochs.find(model);
+        if (it == m_epochs.end())
+        {
+            model->TraceConnectWithoutContext("CourseChange", GetCourseChangeSink());
+            it = m_epochs.emplace(model, 0).first;
+        }
+        return it->second;
+    }
+
+    /**
+     * The sink is bound to a const this both when connecting and when                                  연결할 때와 해제할 때 모두 const this에 바인딩하므로, 두 콜백은 같다고
+     * disconnecting, so that the two callbacks compare equal.                                          비교되어 해제가 실제로 싱크를 제거합니다.
+     *
+     * \return the sink of the CourseChange traces                                                      CourseChange 트레이스의 싱크
+     */
+    Callback<void, Ptr<const MobilityModel>> GetCourseChangeSink() const
+    {
+        return MakeCallback(&CachedHybridBuildingsPropagationLossModel::CourseChange, this);
+    }
+
+    /**
+     * Sink of the CourseChange trace of the mobility models.                                           이동성 모델의 CourseChange 트레이스 싱크
+     *
+     * \param model the mobility model whose position changed                                           위치가 바뀐 이동성 모델
+     */
+    void CourseChange(Ptr<const MobilityModel> model) const
+    {
+        auto it = m_epochs.find(ConstCast<MobilityModel>(model));
+        if (it != m_epochs.end())
+        {
+            ++it->second;
+        }
+    }
+
+    /// Cached losses per (tx, rx) mobility pair                                                        (송신, 수신) 이동성 모델 쌍별 캐시된 손실
+    mutable std::map<std::pair<Ptr<MobilityModel>, Ptr<MobilityModel>>, CacheEntry> m_cache;
+    mutable std::map<Ptr<MobilityModel>, uint32_t> m_epochs; ///< position epoch per mobility model
+    mutable TracedValue<uint64_t> m_hits{0};                 ///< losses taken from the cache
+    mutable TracedValue<uint64_t> m_misses{0};               ///< losses computed by the model
+};
+
+NS_OBJECT_ENSURE_REGISTERED(CachedHybridBuildingsPropagationLossModel);
+
+} // namespace ns3
+
+#endif // LENA_CACHED_BUILDINGS_PATHLOSS_H
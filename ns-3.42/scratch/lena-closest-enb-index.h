@@ -0,0 +1,202 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef LENA_CLOSEST_ENB_INDEX_H
+#define LENA_CLOSEST_ENB_INDEX_H
+
+#include <ns3/assert.h>
+#include <ns3/lte-helper.h>
+#include <ns3/mobility-model.h>
+#include <ns3/net-device-container.h>
+#include <ns3/node.h>
+#include <ns3/vector.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * Uniform grid over the eNB positions answering nearest-eNB queries.                                   가장 가까운 eNB 질의에 답하는 eNB 위치 위의 균일 그리드
+ *
+ * The result is the one of the brute-force scan of LteHelper::AttachToClosestEnb():                    결과는 LteHelper::AttachToClosestEnb()의 전수 탐색과 같습니다:
+ * the distance is the 3D CalculateDistance() and, among eNBs at the same                               거리는 3D CalculateDistance()이며, 같은 거리의 eNB 중에서는
+ * distance, the one with the lowest index wins. The grid is 2D (x, y), with                            가장 낮은 인덱스가 선택됩니다. 그리드는 2D (x, y)이며 셀 크기는
+ * cells sized so that they hold about one eNB each; the query visits rings of                          셀마다 약 하나의 eNB가 들어가도록 정해집니다. 질의는 UE의 셀 주변 링을
+ * cells around the UE until no unvisited cell can hold a closer eNB.                                   더 가까운 eNB가 있을 수 없을 때까지 방문합니다.
+ */
+class ClosestEnbIndex
+{
+  public:
+    /**
+     * Build the index.                                                                                 인덱스를 생성합니다.
+     * \param enbPositions the eNB positions; the returned indices refer to this vector                 eNB 위치 (반환되는 인덱스는 이 벡터를 가리킵니다)
+     */
+    explicit ClosestEnbIndex(const std::vector<Vector>& enbPositions)
+        : m_positions(enbPositions)
+    {
+        NS_ASSERT_MSG(!m_positions.empty(), "no eNB to index");
+        m_xMin = m_xMax = m_positions[0].x;
+        m_yMin = m_yMax = m_positions[0].y;
+        for (const auto& p : m_positions)
+        {
+            m_xMin = std::min(m_xMin, p.x);
+            m_xMax = std::max(m_xMax, p.x);
+            m_yMin = std::min(m_yMin, p.y);
+            m_yMax = std::max(m_yMax, p.y);
+        }
+        double area = std::max(m_xMax - m_xMin, 1.0) * std::max(m_yMax - m_yMin, 1.0);
+        m_cellSize = std::sqrt(area / m_positions.size());
+        m_nx = static_cast<uint32_t>((m_xMax - m_xMin) / m_cellSize) + 1;
+        m_ny = static_cast<uint32_t>((m_yMax - m_yMin) / m_cellSize) + 1;
+        m_cells.resize(static_cast<std::size_t>(m_nx) * m_ny);
+        // indices are pushed in increasing order, which the tie-breaking relies on                     인덱스는 오름차순으로 추가되며, 동점 처리는 이에 의존합니다.
+        for (uint32_t i = 0; i < m_positions.size(); ++i)
+        {
+            m_cells[CellIndex(CellX(m_positions[i].x), CellY(m_positions[i].y))].push_back(i);
+        }
+    }
+
+    /**
+     * \param position the position of the UE                                                           UE의 위치
+     * \return the index of the closest eNB                                                             가장 가까운 eNB의 인덱스
+     */
+    uint32_t FindClosest(const Vector& position) const
+    {
+        int64_t cx = CellX(position.x);
+        int64_t cy = CellY(position.y);
+        int64_t maxRing = std::max(m_nx, m_ny);
+        double minDistance = std::numeric_limits<double>::infinity();
+        uint32_t closest = 0;
+        for (int64_t ring = 0; ring <= maxRing; ++ring)
+        {
+            for (int64_t x = cx - ring; x <= cx + ring; ++x)
+            {
+                if (x < 0 || x >= m_nx)
+                {
+                    continue;
+                }
+                // only the border of the ring, the inside has been visited already                     링의 경계만 방문합니다 (안쪽은 이미 방문함)
+                bool borderColumn = (x == cx - ring || x == cx + ring);
+                int64_t step = borderColumn ? 1 : 2 * ring;
+                for (int64_t y = cy - ring; y <= cy + ring; y += step)
+                {
+                    if (y < 0 || y >= m_ny)
+                    {
+                        continue;
+                    }
+                    for (uint32_t i : m_cells[CellIndex(x, y)])
+                    {
+                        double distance = CalculateDistance(position, m_positions[i]);
+                        if (distance < minDistance || (distance == minDistance && i < closest))
+                        {
+                            minDistance = distance;
+                            closest = i;
+                        }
+                    }
+                }
+            }
+            // cells beyond this ring are at least ring * m_cellSize away (in the x-y plane)            이 링 바깥의 셀들은 (x-y 평면에서) 최소 ring * m_cellSize만큼 떨어져 있습니다.
+            if (minDistance < ring * m_cellSize)
+            {
+                break;
+            }
+        }
+        return closest;
+    }
+
+  private:
+    /**
+     * \param x the x coordinate
+     * \return the column of the cell holding x, clamped to the grid
+     */
+    int64_t CellX(double x) const
+    {
+        return std::clamp<int64_t>(static_cast<int64_t>(std::floor((x - m_xMin) / m_cellSize)),
+                                   0,
+                                   m_nx - 1);
+    }
+
+    /**
+     * \param y the y coordinate
+     * \return the row of the cell holding y, clamped to the grid
+     */
+    int64_t CellY(double y) const
+    {
+        return std::clamp<int64_t>(static_cast<int64_t>(std::floor((y - m_yMin) / m_cellSize)),
+                                   0,
+                                   m_ny - 1);
+    }
+
+    /**
+     * \param x the column
+     * \param y the row
+     * \return the index of the cell in m_cells
+     */
+    std::size_t CellIndex(int64_t x, int64_t y) const
+    {
+        return static_cast<std::size_t>(y) * m_nx + static_cast<std::size_t>(x);
+    }
+
+    std::vector<Vector> m_positions;            ///< eNB positions
+    std::vector<std::vector<uint32_t>> m_cells; ///< eNB indices per cell, row-major
+    double m_xMin;                              ///< lower x bound of the grid
+    double m_xMax;                              ///< upper x bound of the grid
+    double m_yMin;                              ///< lower y bound of the grid
+    double m_yMax;                              ///< upper y bound of the grid
+    double m_cellSize;                          ///< side of a cell [m]
+    int64_t m_nx;                               ///< number of columns
+    int64_t m_ny;                               ///< number of rows
+};
+
+/**
+ * Attach every UE to the closest eNB, as LteHelper::AttachToClosestEnb() does,                         LteHelper::AttachToClosestEnb()처럼 각 UE를 가장 가까운 eNB에 연결하지만,
+ * but with the eNB lookup done through a ClosestEnbIndex, i.e., in about                               eNB 탐색은 ClosestEnbIndex를 사용하므로 전체 O(UE×eNB)가 아닌
+ * constant time per UE instead of O(UE×eNB) overall.                                                   UE당 거의 상수 시간에 수행됩니다.
+ *
+ * \param lteHelper the LteHelper used for the attachment                                               연결에 사용할 LteHelper
+ * \param ueDevices the UE devices                                                                      UE 장치
+ * \param enbDevices the candidate eNB devices                                                          후보 eNB 장치
+ */
+inline void
+AttachToClosestEnbIndexed(Ptr<LteHelper> lteHelper,
+                          NetDeviceContainer ueDevices,
+                          NetDeviceContainer enbDevices)
+{
+    if (ueDevices.GetN() == 0)
+    {
+        return;
+    }
+    std::vector<Vector> enbPositions;
+    enbPositions.reserve(enbDevices.GetN());
+    for (auto it = enbDevices.Begin(); it != enbDevices.End(); ++it)
+    {
+        enbPositions.push_back((*it)->GetNode()->GetObject<MobilityModel>()->GetPosition());
+    }
+    ClosestEnbIndex index(enbPositions);
+    for (auto it = ueDevices.Begin(); it != ueDevices.End(); ++it)
+    {
+        Vector uePosition = (*it)->GetNode()->GetObject<MobilityModel>()->GetPosition();
+        lteHelper->Attach(*it, enbDevices.Get(index.FindClosest(uePosition)));
+    }
+}
+
+} // namespace ns3
+
+#endif // LENA_CLOSEST_ENB_INDEX_H
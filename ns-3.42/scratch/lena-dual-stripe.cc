@@ -17,6 +17,15 @@
  * Author: Nicola Baldo <nbaldo@cttc.es>
  */
 
+#include "lena-cached-buildings-pathloss.h"
+#include "lena-closest-enb-index.h"
+#include "lena-lte-binary-traces.h"
+#include "lena-lte-device-registry.h"
+#include "lena-mapped-fading-trace.h"
+#include "lena-rem-tiles.h"
+#include "lena-spectrum-culling.h"
+#include "lena-subframe-calendar-scheduler.h"
+
 #include <ns3/applications-module.h>
 #include <ns3/buildings-module.h>
 #include <ns3/config-store-module.h>
@@ -28,8 +37,13 @@
 #include <ns3/network-module.h>
 #include <ns3/point-to-point-helper.h>
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
 #include <iomanip>
 #include <ios>
+#include <iostream>
+#include <limits>
 #include <string>
 #include <vector>
 
@@ -59,6 +73,18 @@ AreOverlapping(Box a, Box b)
  * Class that takes care of installing blocks of the                                                    주어진 영역에 빌딩 블록을 설치하는 클래스 정의
  * buildings in a given area. Buildings are installed in pairs                                          빌딩은 듀얼 스트라이프 시나리오에서와 같이 쌍으로 설치됨
  * as in dual stripe scenario.
+ *
+ * The blocks already created are kept in a uniform occupancy grid whose cells                          이미 생성된 블록은 셀 크기가 블록 크기와 같은 균일 점유 그리드에 저장되므로
+ * have the size of a block, so checking a candidate position only looks at                             후보 위치를 검사할 때 최대 네 개 셀의 블록만 확인합니다.
+ * the blocks of at most four cells. Blocks are first placed at random; if                              블록은 먼저 무작위로 배치되며, 무작위 시도가 계속 실패하면 블록 크기보다
+ * random attempts keep failing, one of the free slots of a lattice whose pitch                         SLOT_GAP만큼 큰 간격의 격자 슬롯 중 빈 슬롯 하나를 선택합니다. 따라서 이웃
+ * is the block size plus SLOT_GAP is picked, so that neighbouring slots can                            슬롯의 블록들이 나란히 놓일 수 있습니다. 빈 슬롯 목록은 블록을 추가할 때
+ * hold blocks side by side. The list of free slots is updated as blocks are                            갱신하므로, 이 경우 블록 배치 비용은 상수입니다. 무작위 블록들이 정렬되지
+ * added, so that placing a block this way costs a constant time. When the                              않은 틈만 남겨 빈 슬롯이 없으면, 영역 가장자리나 기존 블록 바로 뒤(SLOT_GAP
+ * random blocks leave only unaligned gaps, the positions against the area                              간격)에 닿는 위치들을 모두 검사합니다. 이 최후 수단은 블록 수의 제곱에
+ * border or SLOT_GAP past an existing block are searched; this last resort                             비례하는 비용이 들지만, SLOT_GAP 이내의 오차로 들어갈 자리가 있는 블록을
+ * costs a time quadratic in the number of blocks, but places a block whenever                          항상 배치합니다.
+ * there is room for it, up to SLOT_GAP.
  */
 class FemtocellBlockAllocator
 {
@@ -86,14 +112,60 @@ class FemtocellBlockAllocator
      * \returns true if there is an overlap                                                             겹치면 참
      */
     bool OverlapsWithAnyPrevious(Box box);
+    /**
+     * Function that picks a free slot for a block, used when random placement keeps failing.           무작위 배치가 계속 실패할 때 사용되며, 블록에 빈 슬롯을 선택하는 함수
+     * \param box the block, whose position is set if a free one is found                               블록 (빈 위치를 찾으면 위치가 설정됨)
+     * \returns true if a free position has been found                                                  빈 위치를 찾으면 참
+     */
+    bool FindFreePosition(Box& box);
+    /**
+     * Function that searches the positions against the area border or SLOT_GAP past an                 빈 슬롯이 없을 때 사용되며, 영역 가장자리나 기존 블록에서 SLOT_GAP 뒤에
+     * existing block, used when no slot is free.                                                       닿는 위치들을 검색하는 함수
+     * \param box the block, whose position is set if a free one is found                               블록 (빈 위치를 찾으면 위치가 설정됨)
+     * \returns true if a free position has been found                                                  빈 위치를 찾으면 참
+     */
+    bool FindGapPosition(Box& box);
+    /**
+     * Function that records a block in the occupancy grid and in the free slots.                       점유 그리드와 빈 슬롯에 블록을 기록하는 함수
+     * \param box the block                                                                             블록
+     */
+    void AddBlock(Box box);
+    /**
+     * \param sx the column of the slot                                                                 슬롯의 열
+     * \param sy the row of the slot                                                                    슬롯의 행
+     * \returns the block placed in the slot                                                            슬롯에 놓인 블록
+     */
+    Box GetSlotBlock(uint32_t sx, uint32_t sy) const;
+    /**
+     * \param x the X coordinate                                                                        X 좌표
+     * \returns the column of the occupancy grid holding x                                              x를 포함하는 점유 그리드의 열
+     */
+    uint32_t GetCellX(double x) const;
+    /**
+     * \param y the Y coordinate                                                                        Y 좌표
+     * \returns the row of the occupancy grid holding y                                                 y를 포함하는 점유 그리드의 행
+     */
+    uint32_t GetCellY(double y) const;
     Box m_area;                           ///< Area                                                     영역
     uint32_t m_nApartmentsX;              ///< X apartments                                             X방향의 아파트 수
     uint32_t m_nFloors;                   ///< number of floors                                         층 수
-    std::list<Box> m_previousBlocks;      ///< previous bocks                                           이전 블록들
+    std::vector<Box> m_previousBlocks;    ///< previous bocks                                           이전 블록들
     double m_xSize;                       ///< X size                                                   X크기
     double m_ySize;                       ///< Y size                                                   Y크기
     Ptr<UniformRandomVariable> m_xMinVar; ///< X minimum variance                                       X 최소 값
     Ptr<UniformRandomVariable> m_yMinVar; ///< Y minimum variance                                       Y 최소 값
+    uint32_t m_nCellsX;                   ///< columns of the occupancy grid                            점유 그리드의 열 수
+    uint32_t m_nCellsY;                   ///< rows of the occupancy grid                               점유 그리드의 행 수
+    std::vector<std::vector<uint32_t>> m_occupancyGrid; ///< blocks touching each cell                  각 셀에 닿는 블록들
+    Ptr<UniformRandomVariable> m_freePositionVar;       ///< picks a free position                      빈 위치 선택
+    uint32_t m_nSlotsX;                                 ///< columns of slots                           슬롯의 열 수
+    uint32_t m_nSlotsY;                                 ///< rows of slots                              슬롯의 행 수
+    std::vector<uint32_t> m_freeSlots;                  ///< slots whose block is free                  블록이 비어 있는 슬롯들
+    std::vector<uint32_t> m_freeIndex;                  ///< index in m_freeSlots, or NOT_FREE          m_freeSlots의 인덱스 또는 NOT_FREE
+    /// m_freeIndex of the slots that are not free                                                      비어 있지 않은 슬롯의 m_freeIndex
+    static constexpr uint32_t NOT_FREE = std::numeric_limits<uint32_t>::max();
+    /// space between the blocks of neighbouring slots, as touching blocks overlap [m]                  닿는 블록은 겹치므로 이웃 슬롯의 블록 사이 간격 [m]
+    static constexpr double SLOT_GAP = 0.001;
 };
 
 FemtocellBlockAllocator::FemtocellBlockAllocator(Box area, uint32_t nApartmentsX, uint32_t nFloors)
@@ -109,6 +181,21 @@ FemtocellBlockAllocator::FemtocellBlockAllocator(Box area, uint32_t nApartmentsX
     m_yMinVar = CreateObject<UniformRandomVariable>();
     m_yMinVar->SetAttribute("Min", DoubleValue(area.yMin));
     m_yMinVar->SetAttribute("Max", DoubleValue(area.yMax - m_ySize));
+    // cells as large as a block: a block touches at most 2x2 cells                                     // 블록 크기의 셀: 하나의 블록은 최대 2x2 셀에 닿습니다.
+    m_nCellsX = std::floor((area.xMax - area.xMin) / m_xSize) + 1;
+    m_nCellsY = std::floor((area.yMax - area.yMin) / m_ySize) + 1;
+    m_occupancyGrid.resize(m_nCellsX * m_nCellsY);
+    // as many slots as fit in the area, all free at first                                              // 영역에 들어가는 만큼의 슬롯이며, 처음에는 모두 비어 있습니다.
+    double width = area.xMax - area.xMin;
+    double height = area.yMax - area.yMin;
+    m_nSlotsX = width < m_xSize ? 0 : std::floor((width - m_xSize) / (m_xSize + SLOT_GAP)) + 1;
+    m_nSlotsY = height < m_ySize ? 0 : std::floor((height - m_ySize) / (m_ySize + SLOT_GAP)) + 1;
+    m_freeIndex.resize(m_nSlotsX * m_nSlotsY);
+    for (uint32_t slot = 0; slot < m_nSlotsX * m_nSlotsY; ++slot)
+    {
+        m_freeIndex[slot] = slot;
+        m_freeSlots.push_back(slot);
+    }
 }
 
 void
@@ -124,21 +211,26 @@ void
 FemtocellBlockAllocator::Create()
 {
     Box box;
-    uint32_t attempt = 0;
-    do
+    bool found = false;
+    for (uint32_t attempt = 0; attempt < 100 && !found; ++attempt)
     {
-        NS_ASSERT_MSG(attempt < 100,
-                      "Too many failed attempts to position apartment block. Too many blocks? Too "     // 아파트 블록을 배치하려는 시도가 너무 많습니다. 블록이 너무 많거나?
-                      "small area?");                                                                   // 영역이 너무 작습니까?
         box.xMin = m_xMinVar->GetValue();
         box.xMax = box.xMin + m_xSize;
         box.yMin = m_yMinVar->GetValue();
         box.yMax = box.yMin + m_ySize;
-        ++attempt;
-    } while (OverlapsWithAnyPrevious(box));
+        found = !OverlapsWithAnyPrevious(box);
+    }
+    if (!found)
+    {
+        NS_LOG_LOGIC("random placement failed, picking one of the free positions");                     // 무작위 배치에 실패하여 빈 위치 중 하나를 선택합니다.
+        found = FindFreePosition(box);
+    }
+    NS_ABORT_MSG_IF(!found,
+                    "No room left to position apartment block. Too many blocks? Too "                   // 아파트 블록을 배치할 공간이 없습니다. 블록이 너무 많거나?
+                    "small area?");                                                                     // 영역이 너무 작습니까?
 
     NS_LOG_LOGIC("allocated non overlapping block " << box);                                            // 겹치지 않는 블록을 할당했습니다.
-    m_previousBlocks.push_back(box);
+    AddBlock(box);
     Ptr<GridBuildingAllocator> gridBuildingAllocator;
     gridBuildingAllocator = CreateObject<GridBuildingAllocator>();
     gridBuildingAllocator->SetAttribute("GridWidth", UintegerValue(1));
@@ -158,16 +250,138 @@ FemtocellBlockAllocator::Create()
 bool
 FemtocellBlockAllocator::OverlapsWithAnyPrevious(Box box)
 {
-    for (auto it = m_previousBlocks.begin(); it != m_previousBlocks.end(); ++it)
+    // overlapping boxes share a point, and both boxes are recorded in the cell holding it              겹치는 박스들은 한 점을 공유하며, 두 박스 모두 그 점을 포함하는 셀에 기록됩니다.
+    for (uint32_t cy = GetCellY(box.yMin); cy <= GetCellY(box.yMax); ++cy)
     {
-        if (AreOverlapping(*it, box))
+        for (uint32_t cx = GetCellX(box.xMin); cx <= GetCellX(box.xMax); ++cx)
         {
-            return true;
+            for (uint32_t i : m_occupancyGrid[cy * m_nCellsX + cx])
+            {
+                if (AreOverlapping(m_previousBlocks[i], box))
+                {
+                    return true;
+                }
+            }
         }
     }
     return false;
 }
 
+bool
+FemtocellBlockAllocator::FindFreePosition(Box& box)
+{
+    // created only when needed, so that the other random streams are left unchanged                    // 필요할 때만 생성하여 다른 난수 스트림이 바뀌지 않도록 합니다.
+    if (!m_freePositionVar)
+    {
+        m_freePositionVar = CreateObject<UniformRandomVariable>();
+    }
+    if (m_freeSlots.empty())
+    {
+        NS_LOG_LOGIC("no free slot, searching the gaps between blocks");                                // 빈 슬롯이 없어 블록 사이의 틈을 검색합니다.
+        return FindGapPosition(box);
+    }
+    uint32_t slot = m_freeSlots[m_freePositionVar->GetInteger(0, m_freeSlots.size() - 1)];
+    box = GetSlotBlock(slot % m_nSlotsX, slot / m_nSlotsX);
+    NS_ASSERT_MSG(!OverlapsWithAnyPrevious(box), "free slot " << box << " is occupied");
+    return true;
+}
+
+bool
+FemtocellBlockAllocator::FindGapPosition(Box& box)
+{
+    // a block that fits can slide down and left until it is against the area border or an              // 들어갈 수 있는 블록은 영역 가장자리나 기존 블록에 닿을 때까지 왼쪽
+    // existing block, so that these positions are enough                                               // 아래로 밀 수 있으므로 이 위치들로 충분합니다.
+    std::vector<double> xMins{m_area.xMin};
+    std::vector<double> yMins{m_area.yMin};
+    for (const Box& block : m_previousBlocks)
+    {
+        xMins.push_back(block.xMax + SLOT_GAP);
+        yMins.push_back(block.yMax + SLOT_GAP);
+    }
+    std::vector<Box> candidates;
+    for (double yMin : yMins)
+    {
+        for (double xMin : xMins)
+        {
+            Box candidate(xMin, xMin + m_xSize, yMin, yMin + m_ySize, 0, 0);
+            if (candidate.xMax <= m_area.xMax && candidate.yMax <= m_area.yMax &&
+                !OverlapsWithAnyPrevious(candidate))
+            {
+                candidates.push_back(candidate);
+            }
+        }
+    }
+    if (candidates.empty())
+    {
+        return false;
+    }
+    box = candidates[m_freePositionVar->GetInteger(0, candidates.size() - 1)];
+    return true;
+}
+
+void
+FemtocellBlockAllocator::AddBlock(Box box)
+{
+    uint32_t index = m_previousBlocks.size();
+    m_previousBlocks.push_back(box);
+    for (uint32_t cy = GetCellY(box.yMin); cy <= GetCellY(box.yMax); ++cy)
+    {
+        for (uint32_t cx = GetCellX(box.xMin); cx <= GetCellX(box.xMax); ++cx)
+        {
+            m_occupancyGrid[cy * m_nCellsX + cx].push_back(index);
+        }
+    }
+
+    // the slots overlapping the new block start less than a block size before it                       // 새 블록과 겹치는 슬롯은 블록 크기보다 가까운 앞에서 시작합니다.
+    double pitchX = m_xSize + SLOT_GAP;
+    double pitchY = m_ySize + SLOT_GAP;
+    uint32_t firstX = std::max(std::ceil((box.xMin - m_area.xMin - m_xSize) / pitchX), 0.0);
+    uint32_t firstY = std::max(std::ceil((box.yMin - m_area.yMin - m_ySize) / pitchY), 0.0);
+    uint32_t endX = std::min<double>(std::floor((box.xMax - m_area.xMin) / pitchX) + 1, m_nSlotsX);
+    uint32_t endY = std::min<double>(std::floor((box.yMax - m_area.yMin) / pitchY) + 1, m_nSlotsY);
+    for (uint32_t sy = firstY; sy < endY; ++sy)
+    {
+        for (uint32_t sx = firstX; sx < endX; ++sx)
+        {
+            uint32_t slot = sy * m_nSlotsX + sx;
+            if (m_freeIndex[slot] != NOT_FREE && AreOverlapping(GetSlotBlock(sx, sy), box))
+            {
+                // swap with the last free slot                                                         // 마지막 빈 슬롯과 교환합니다.
+                uint32_t last = m_freeSlots.back();
+                m_freeSlots[m_freeIndex[slot]] = last;
+                m_freeIndex[last] = m_freeIndex[slot];
+                m_freeSlots.pop_back();
+                m_freeIndex[slot] = NOT_FREE;
+            }
+        }
+    }
+}
+
+Box
+FemtocellBlockAllocator::GetSlotBlock(uint32_t sx, uint32_t sy) const
+{
+    Box box;
+    box.xMin = m_area.xMin + sx * (m_xSize + SLOT_GAP);
+    box.xMax = box.xMin + m_xSize;
+    box.yMin = m_area.yMin + sy * (m_ySize + SLOT_GAP);
+    box.yMax = box.yMin + m_ySize;
+    return box;
+}
+
+uint32_t
+FemtocellBlockAllocator::GetCellX(double x) const
+{
+    double cell = std::floor((x - m_area.xMin) / m_xSize);
+    return std::min<double>(std::max(cell, 0.0), m_nCellsX - 1);
+}
+
+uint32_t
+FemtocellBlockAllocator::GetCellY(double y) const
+{
+    double cell = std::floor((y - m_area.yMin) / m_ySize);
+    return std::min<double>(std::max(cell, 0.0), m_nCellsY - 1);
+}
+
 /**
  * Print a list of buildings that can be plotted using Gnuplot.                                         Gunplot을 사용하여 플롯할 수 있는 빌딩 목록을 파일로 출력
  *
@@ -197,9 +411,10 @@ PrintGnuplottableBuildingListToFile(std::string filename)
  * Print a list of UEs that can be plotted using Gnuplot.                                               Gunplot을 사용하여 플롯할 수 있는 ENB 목록을 파일로 출력합니다.
  *
  * \param filename the output file name.                                                                출력 파일 이름
+ * \param devices the registered LTE devices                                                            등록된 LTE 장치
  */
 void
-PrintGnuplottableUeListToFile(std::string filename)
+PrintGnuplottableUeListToFile(std::string filename, const LteDeviceRegistry& devices)
 {
     std::ofstream outFile;
     outFile.open(filename, std::ios_base::out | std::ios_base::trunc);
@@ -208,22 +423,13 @@ PrintGnuplottableUeListToFile(std::string filename)
         NS_LOG_ERROR("Can't open file " << filename);                                                   // 파일을 열 수 없습니다
         return;
     }
-    for (auto it = NodeList::Begin(); it != NodeList::End(); ++it)
+    for (const auto& ue : devices.GetUes())
     {
-        Ptr<Node> node = *it;
-        int nDevs = node->GetNDevices();
-        for (int j = 0; j < nDevs; j++)
-        {
-            Ptr<LteUeNetDevice> uedev = node->GetDevice(j)->GetObject<LteUeNetDevice>();
-            if (uedev)
-            {
-                Vector pos = node->GetObject<MobilityModel>()->GetPosition();
-                outFile << "set label \"" << uedev->GetImsi() << "\" at " << pos.x << "," << pos.y
-                        << " left font \"Helvetica,4\" textcolor rgb \"grey\" front point pt 1 ps "
-                           "0.3 lc rgb \"grey\" offset 0,0"
-                        << std::endl;
-            }
-        }
+        Vector pos = ue.node->GetObject<MobilityModel>()->GetPosition();
+        outFile << "set label \"" << ue.dev->GetImsi() << "\" at " << pos.x << "," << pos.y
+                << " left font \"Helvetica,4\" textcolor rgb \"grey\" front point pt 1 ps 0.3 lc "
+                   "rgb \"grey\" offset 0,0"
+                << std::endl;
     }
 }
 
@@ -231,9 +437,10 @@ PrintGnuplottableUeListToFile(std::string filename)
  * Print a list of ENBs that can be plotted using Gnuplot.                                              Gnuplot을 사용하여 플로팅할 수 있는 ENB 목록을 인쇄합니다.
  *
  * \param filename the output file name.                                                                출력 파일 이름
+ * \param devices the registered LTE devices                                                            등록된 LTE 장치
  */
 void
-PrintGnuplottableEnbListToFile(std::string filename)
+PrintGnuplottableEnbListToFile(std::string filename, const LteDeviceRegistry& devices)
 {
     std::ofstream outFile;
     outFile.open(filename, std::ios_base::out | std::ios_base::trunc);
@@ -242,23 +449,13 @@ PrintGnuplottableEnbListToFile(std::string filename)
         NS_LOG_ERROR("Can't open file " << filename);                                                   // 파일을 열 수 없습니다.
         return;
     }
-    for (auto it = NodeList::Begin(); it != NodeList::End(); ++it)
+    for (const auto& enb : devices.GetEnbs())
     {
-        Ptr<Node> node = *it;
-        int nDevs = node->GetNDevices();
-        for (int j = 0; j < nDevs; j++)
-        {
-            Ptr<LteEnbNetDevice> enbdev = node->GetDevice(j)->GetObject<LteEnbNetDevice>();
-            if (enbdev)
-            {
-                Vector pos = node->GetObject<MobilityModel>()->GetPosition();
-                outFile << "set label \"" << enbdev->GetCellId() << "\" at " << pos.x << ","
-                        << pos.y
-                        << " left font \"Helvetica,4\" textcolor rgb \"white\" front  point pt 2 "
-                           "ps 0.3 lc rgb \"white\" offset 0,0"
-                        << std::endl;
-            }
-        }
+        Vector pos = enb.node->GetObject<MobilityModel>()->GetPosition();
+        outFile << "set label \"" << enb.dev->GetCellId() << "\" at " << pos.x << "," << pos.y
+                << " left font \"Helvetica,4\" textcolor rgb \"white\" front  point pt 2 ps 0.3 "
+                   "lc rgb \"white\" offset 0,0"
+                << std::endl;
     }
 }
 
@@ -392,6 +589,20 @@ static ns3::GlobalValue g_remRbId(
     ns3::IntegerValue(-1),
     MakeIntegerChecker<int32_t>());
 
+/// Number of tiles the REM grid is split into                                                          REM 그리드를 나눌 타일 수
+static ns3::GlobalValue g_remTiles(
+    "remTiles",
+    "Number of tiles the REM grid is split into along the X axis; "
+    "each tile can be computed in parallel by a separate process",                                      // 각 타일은 별도의 프로세스에서 병렬로 계산할 수 있습니다.
+    ns3::UintegerValue(1),
+    ns3::MakeUintegerChecker<uint32_t>(1));
+
+/// REM tile computed by this run                                                                       이번 실행에서 계산할 REM 타일
+static ns3::GlobalValue g_remTileId("remTileId",
+                                    "REM tile computed by this run, in [0, remTiles)",
+                                    ns3::UintegerValue(0),
+                                    ns3::MakeUintegerChecker<uint32_t>());
+
 /// If true, will setup the EPC to simulate an end-to-end topology.                                     참인 경우 EPC를 설정하여 종단 간 토폴로지를 시뮬레이트합니다.
 static ns3::GlobalValue g_epc(
     "epc",
@@ -437,6 +648,14 @@ static ns3::GlobalValue g_fadingTrace("fadingTrace",
                                       ns3::StringValue(""),
                                       ns3::MakeStringChecker());
 
+/// Format of the MAC/RLC/PDCP traces: "text" (LteHelper) or "binary" (LteBinaryTraces)                 MAC/RLC/PDCP 트레이스 형식: "text"(LteHelper) 또는 "binary"(LteBinaryTraces)
+static ns3::GlobalValue g_traceFormat("traceFormat",
+                                      "Format of the MAC/RLC/PDCP traces: \"text\" writes the "
+                                      "LteHelper stats files, \"binary\" writes LteTraces.bin, "
+                                      "which lena-lte-trace-converter turns into the same files",
+                                      ns3::StringValue("text"),
+                                      ns3::MakeStringChecker());
+
 /// How many bearers per UE there are in the simulation                                                 시뮬레이션에서 UE 당 베어러 수
 static ns3::GlobalValue g_numBearersPerUe("numBearersPerUe",
                                           "How many bearers per UE there are in the simulation",
@@ -464,6 +683,22 @@ static ns3::GlobalValue g_outdoorUeMaxSpeed(
     ns3::DoubleValue(0.0),
     ns3::MakeDoubleChecker<double>());
 
+/// Minimum received power [dBm] of the signals delivered by the spectrum channels                      스펙트럼 채널이 전달하는 신호의 최소 수신 전력 [dBm]
+static ns3::GlobalValue g_minRxPowerDbm(
+    "minRxPowerDbm",
+    "Minimum received power [dBm] of the signals delivered by the spectrum channels, "
+    "with the strongest eNB transmission power (by default all signals are delivered)",
+    ns3::DoubleValue(-std::numeric_limits<double>::infinity()),
+    ns3::MakeDoubleChecker<double>());
+
+/// Print the number of UEs and the run time and events of Simulator::Run()                             UE 수와 Simulator::Run()의 실행 시간 및 이벤트 수 출력
+static ns3::GlobalValue g_reportRunTime(
+    "reportRunTime",
+    "Print the number of UEs, and the wall-clock time and number of events of the run, "
+    "e.g. to compare the event schedulers selected with SchedulerType",
+    ns3::BooleanValue(false),
+    ns3::MakeBooleanChecker());
+
 int
 main(int argc, char* argv[])
 {
@@ -535,8 +770,16 @@ main(int argc, char* argv[])
     bool generateRem = booleanValue.Get();
     GlobalValue::GetValueByName("remRbId", integerValue);                                               // REM RB ID
     int32_t remRbId = integerValue.Get();
+    GlobalValue::GetValueByName("remTiles", uintegerValue);                                             // REM 타일 수
+    uint32_t remTiles = uintegerValue.Get();
+    GlobalValue::GetValueByName("remTileId", uintegerValue);                                            // REM 타일 번호
+    uint32_t remTileId = uintegerValue.Get();
     GlobalValue::GetValueByName("fadingTrace", stringValue);                                            // 페이딩 추적 파일 이름
     std::string fadingTrace = stringValue.Get();
+    GlobalValue::GetValueByName("traceFormat", stringValue);                                            // 트레이스 형식
+    std::string traceFormat = stringValue.Get();
+    NS_ABORT_MSG_IF(traceFormat != "text" && traceFormat != "binary",
+                    "traceFormat must be \"text\" or \"binary\"");
     GlobalValue::GetValueByName("numBearersPerUe", uintegerValue);                                      // UE 당 베어러 수
     uint16_t numBearersPerUe = uintegerValue.Get();
     GlobalValue::GetValueByName("srsPeriodicity", uintegerValue);                                       // SRS 주기성
@@ -545,6 +788,10 @@ main(int argc, char* argv[])
     uint16_t outdoorUeMinSpeed = doubleValue.Get();
     GlobalValue::GetValueByName("outdoorUeMaxSpeed", doubleValue);                                      // 외부 UE 최대 속도
     uint16_t outdoorUeMaxSpeed = doubleValue.Get();
+    GlobalValue::GetValueByName("minRxPowerDbm", doubleValue);                                          // 최소 수신 전력
+    double minRxPowerDbm = doubleValue.Get();
+    GlobalValue::GetValueByName("reportRunTime", booleanValue);                                         // 실행 시간 출력 여부
+    bool reportRunTime = booleanValue.Get();
 
     Config::SetDefault("ns3::LteEnbRrc::SrsPeriodicity", UintegerValue(srsPeriodicity));                // LTE eNB RRC의 SRS 주기성 설정
 
@@ -604,20 +851,26 @@ main(int argc, char* argv[])
 
     Ptr<LteHelper> lteHelper = CreateObject<LteHelper>();                                               // LTEHelper를 생성하고 속성을 설정합니다.
     lteHelper->SetAttribute("PathlossModel",
-                            StringValue("ns3::HybridBuildingsPropagationLossModel"));
+                            StringValue("ns3::CachedHybridBuildingsPropagationLossModel"));
     lteHelper->SetPathlossModelAttribute("ShadowSigmaExtWalls", DoubleValue(0));
     lteHelper->SetPathlossModelAttribute("ShadowSigmaOutdoor", DoubleValue(1));
     lteHelper->SetPathlossModelAttribute("ShadowSigmaIndoor", DoubleValue(1.5));
     // use always LOS model
     lteHelper->SetPathlossModelAttribute("Los2NlosThr", DoubleValue(1e6));
     lteHelper->SetSpectrumChannelType("ns3::MultiModelSpectrumChannel");
+    if (std::isfinite(minRxPowerDbm))
+    {
+        SetSpectrumCulling(lteHelper,
+                           minRxPowerDbm,
+                           std::max(macroEnbTxPowerDbm, homeEnbTxPowerDbm));
+    }
 
     //   lteHelper->EnableLogComponents ();
     //   LogComponentEnable ("PfFfMacScheduler", LOG_LEVEL_ALL);
 
     if (!fadingTrace.empty())                                                                           // 페이딩 모델이 지정된 경우 설정합니다.
     {
-        lteHelper->SetAttribute("FadingModel", StringValue("ns3::TraceFadingLossModel"));
+        lteHelper->SetAttribute("FadingModel", StringValue("ns3::MappedTraceFadingLossModel"));
         lteHelper->SetFadingModelAttribute("TraceFilename", StringValue(fadingTrace));
     }
 
@@ -741,6 +994,13 @@ main(int argc, char* argv[])
 
     NetDeviceContainer macroUeDevs = lteHelper->InstallUeDevice(macroUes);
 
+    // Index the devices for the Gnuplot printers                                                       Gnuplot 출력 함수를 위해 장치 색인
+    LteDeviceRegistry devices;
+    devices.Add(macroEnbDevs);
+    devices.Add(homeEnbDevs);
+    devices.Add(homeUeDevs);
+    devices.Add(macroUeDevs);
+
     Ipv4Address remoteHostAddr;
     NodeContainer ues;
     Ipv4StaticRoutingHelper ipv4RoutingHelper;
@@ -797,7 +1057,7 @@ main(int argc, char* argv[])
     else
     {
         // macro UEs attached to the closest macro eNB                                                  매크로 UEs를 가장 가까운 매크로 eNB에 연결합니다.
-        lteHelper->AttachToClosestEnb(macroUeDevs, macroEnbDevs);
+        AttachToClosestEnbIndexed(lteHelper, macroUeDevs, macroEnbDevs);
 
         // each home UE is attached explicitly to its home eNB                                          각 홈 UE는 해당 홈 eNB에 명시적으로 연결됩니다.
         NetDeviceContainer::Iterator ueDevIt;
@@ -959,8 +1219,8 @@ main(int argc, char* argv[])
     if (generateRem)
     {
         PrintGnuplottableBuildingListToFile("buildings.txt");                                       // 건물, eNB, UE 목록을 파일로 출력
-        PrintGnuplottableEnbListToFile("enbs.txt");
-        PrintGnuplottableUeListToFile("ues.txt");
+        PrintGnuplottableEnbListToFile("enbs.txt", devices);
+        PrintGnuplottableUeListToFile("ues.txt", devices);
 
         remHelper = CreateObject<RadioEnvironmentMapHelper>();                                      // RadioEnvironmentMapHelper 객체 생성
         remHelper->SetAttribute("Channel", PointerValue(lteHelper->GetDownlinkSpectrumChannel()));  // 속성 설정
@@ -976,6 +1236,7 @@ main(int argc, char* argv[])
             remHelper->SetAttribute("UseDataChannel", BooleanValue(true));
             remHelper->SetAttribute("RbId", IntegerValue(remRbId));
         }
+        ConfigureRemTile(remHelper, remTiles, remTileId);                                               // 병렬 계산을 위해 REM 타일 선택
 
         remHelper->Install();                                                                       // REM 설치
         // simulation will stop right after the REM has been generated                              // REM 생성 후 시뮬레이션이 종료됩니다.
@@ -985,14 +1246,52 @@ main(int argc, char* argv[])
         Simulator::Stop(Seconds(simTime));                                                          // REM 생성을 하지 않는 경우 지정된 시뮬레이션 시간 후 시뮬레이션 종료
     }
 
-    lteHelper->EnableMacTraces();                                                                   // MAC 추적 활성화
-    lteHelper->EnableRlcTraces();                                                                   // RLC 추적 활성화
-    if (epc)
+    LteBinaryTraces binaryTraces;
+    if (traceFormat == "binary")
     {
-        lteHelper->EnablePdcpTraces();
+        binaryTraces.EnableMacTraces();                                                             // 이진 MAC 추적 활성화
+        binaryTraces.EnableRlcTraces();                                                             // 이진 RLC 추적 활성화
+        if (epc)
+        {
+            binaryTraces.EnablePdcpTraces();
+        }
+    }
+    else
+    {
+        lteHelper->EnableMacTraces();                                                               // MAC 추적 활성화
+        lteHelper->EnableRlcTraces();                                                               // RLC 추적 활성화
+        if (epc)
+        {
+            lteHelper->EnablePdcpTraces();
+        }
     }
 
+    SpectrumCullingCounter dlCulling;
+    SpectrumCullingCounter ulCulling;
+    if (std::isfinite(minRxPowerDbm))
+    {
+        dlCulling.Attach(lteHelper->GetDownlinkSpectrumChannel());                                  // 잘린 신호 수 집계
+        ulCulling.Attach(lteHelper->GetUplinkSpectrumChannel());
+    }
+
+    auto runStart = std::chrono::steady_clock::now();
     Simulator::Run();                                                                               // 시뮬레이션 실행
+    if (reportRunTime)
+    {
+        std::chrono::duration<double> runTime = std::chrono::steady_clock::now() - runStart;
+        std::cout << "UEs: " << nHomeUes + nMacroUes << ", events: " << Simulator::GetEventCount()
+                  << ", run time: " << runTime.count() << " s, events per second: "
+                  << Simulator::GetEventCount() / runTime.count() << std::endl;
+    }
+
+    if (std::isfinite(minRxPowerDbm))
+    {
+        std::cout << "culled deliveries: DL " << dlCulling.GetCulled() << " of "
+                  << dlCulling.GetCulled() + dlCulling.GetDelivered() << ", UL "
+                  << ulCulling.GetCulled() << " of "
+                  << ulCulling.GetCulled() + ulCulling.GetDelivered() << std::endl;
+    }
+    binaryTraces.Close();                                                                           // 남은 이진 레코드 기록
 
     // GtkConfigStore config;                                                                       GtkConfigStore 객체를 사용하여 추가적인 설정을 구성할 수 있음
     // config.ConfigureAttributes ();                                                               현재 코드에서는 사용되지 않음
@@ -17,6 +17,8 @@
  * Author: Marco Miozzo <marco.miozzo@cttc.es>
  */
 
+#include "lena-mapped-fading-trace.h"
+
 #include "ns3/config-store.h"
 #include "ns3/core-module.h"
 #include "ns3/lte-module.h"
@@ -56,7 +58,7 @@ main(int argc, char* argv[])
     // Uncomment to enable logging                                                          로깅을 활성화하려면 주석을 해제하세요
     // lteHelper->EnableLogComponents ();
 
-    lteHelper->SetAttribute("FadingModel", StringValue("ns3::TraceFadingLossModel"));
+    lteHelper->SetAttribute("FadingModel", StringValue("ns3::MappedTraceFadingLossModel"));
 
     std::ifstream ifTraceFile;
     ifTraceFile.open("../../src/lte/model/fading-traces/fading_trace_EPA_3kmph.fad",
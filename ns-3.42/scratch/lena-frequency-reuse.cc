@@ -18,6 +18,11 @@
  *
  */
 
+#include "lena-batch-runs.h"
+#include "lena-closest-enb-index.h"
+#include "lena-lte-device-registry.h"
+#include "lena-rem-tiles.h"
+
 #include "ns3/core-module.h"
 #include "ns3/lte-module.h"
 #include "ns3/mobility-module.h"
@@ -26,12 +31,15 @@
 #include <ns3/log.h>
 #include <ns3/spectrum-module.h>
 
+#include <iomanip>
+#include <sstream>
+
 using namespace ns3;
 
 NS_LOG_COMPONENT_DEFINE("LenaFrequencyReuse");
 
 void
-PrintGnuplottableUeListToFile(std::string filename)
+PrintGnuplottableUeListToFile(std::string filename, const LteDeviceRegistry& devices)
 {
     std::ofstream outFile;
     outFile.open(filename, std::ios_base::out | std::ios_base::trunc);
@@ -40,27 +48,18 @@ PrintGnuplottableUeListToFile(std::string filename)
         NS_LOG_ERROR("Can't open file " << filename);                                                   // 파일을 열 수 없습니다.
         return;
     }
-    for (auto it = NodeList::Begin(); it != NodeList::End(); ++it)
+    for (const auto& ue : devices.GetUes())
     {
-        Ptr<Node> node = *it;
-        int nDevs = node->GetNDevices();
-        for (int j = 0; j < nDevs; j++)
-        {
-            Ptr<LteUeNetDevice> uedev = node->GetDevice(j)->GetObject<LteUeNetDevice>();
-            if (uedev)
-            {
-                Vector pos = node->GetObject<MobilityModel>()->GetPosition();
-                outFile << "set label \"" << uedev->GetImsi() << "\" at " << pos.x << "," << pos.y
-                        << " left font \"Helvetica,4\" textcolor rgb \"grey\" front point pt 1 ps "
-                           "0.3 lc rgb \"grey\" offset 0,0"
-                        << std::endl;
-            }
-        }
+        Vector pos = ue.node->GetObject<MobilityModel>()->GetPosition();
+        outFile << "set label \"" << ue.dev->GetImsi() << "\" at " << pos.x << "," << pos.y
+                << " left font \"Helvetica,4\" textcolor rgb \"grey\" front point pt 1 ps 0.3 lc "
+                   "rgb \"grey\" offset 0,0"
+                << std::endl;
     }
 }
 
 void
-PrintGnuplottableEnbListToFile(std::string filename)
+PrintGnuplottableEnbListToFile(std::string filename, const LteDeviceRegistry& devices)
 {
     std::ofstream outFile;
     outFile.open(filename, std::ios_base::out | std::ios_base::trunc);
@@ -69,69 +68,52 @@ PrintGnuplottableEnbListToFile(std::string filename)
         NS_LOG_ERROR("Can't open file " << filename);                                                   // 파일을 열 수 없습니다.
         return;
     }
-    for (auto it = NodeList::Begin(); it != NodeList::End(); ++it)
+    for (const auto& enb : devices.GetEnbs())
     {
-        Ptr<Node> node = *it;
-        int nDevs = node->GetNDevices();
-        for (int j = 0; j < nDevs; j++)
-        {
-            Ptr<LteEnbNetDevice> enbdev = node->GetDevice(j)->GetObject<LteEnbNetDevice>();
-            if (enbdev)
-            {
-                Vector pos = node->GetObject<MobilityModel>()->GetPosition();
-                outFile << "set label \"" << enbdev->GetCellId() << "\" at " << pos.x << ","
-                        << pos.y
-                        << " left font \"Helvetica,4\" textcolor rgb \"white\" front  point pt 2 "
-                           "ps 0.3 lc rgb \"white\" offset 0,0"
-                        << std::endl;
-            }
-        }
+        Vector pos = enb.node->GetObject<MobilityModel>()->GetPosition();
+        outFile << "set label \"" << enb.dev->GetCellId() << "\" at " << pos.x << "," << pos.y
+                << " left font \"Helvetica,4\" textcolor rgb \"white\" front  point pt 2 ps 0.3 "
+                   "lc rgb \"white\" offset 0,0"
+                << std::endl;
     }
 }
 
-int
-main(int argc, char* argv[])
+/**
+ * Simulate one run of the scenario.                                                                    시나리오의 한 번의 실행을 시뮬레이션합니다.
+ *
+ * \param run the RngRun value of this run                                                              이번 실행의 RngRun 값
+ * \param nRuns the number of runs simulated in this process                                            이 프로세스에서 시뮬레이션하는 실행 수
+ * \param numberOfRandomUes the number of random UEs                                                    랜덤 UE의 수
+ * \param simTime the duration of the simulation [s]                                                    시뮬레이션 시간 [초]
+ * \param generateSpectrumTrace whether a Spectrum Analyzer trace is generated                          Spectrum Analyzer 추적 생성 여부
+ * \param generateRem whether a REM is generated instead of the simulation                              시뮬레이션 대신 REM 생성 여부
+ * \param remRbId the RB of the REM, -1 for the average of all the RBs                                  REM의 RB (-1이면 모든 RB의 평균)
+ * \param remTiles the number of REM tiles                                                              REM 타일 수
+ * \param remTileId the REM tile computed by this run                                                   이번 실행에서 계산할 REM 타일
+ * \param bandwidth the bandwidth [RBs]                                                                 대역폭 [RB]
+ * \param distance the distance between the eNBs [m]                                                    eNB 간 거리 [m]
+ * \param macroUeBox the area of the random UEs                                                         랜덤 UE의 영역
+ */
+void
+RunOnce(uint64_t run,
+        uint32_t nRuns,
+        uint16_t numberOfRandomUes,
+        double simTime,
+        bool generateSpectrumTrace,
+        bool generateRem,
+        int32_t remRbId,
+        uint32_t remTiles,
+        uint32_t remTileId,
+        uint16_t bandwidth,
+        double distance,
+        Box macroUeBox)
 {
-    Config::SetDefault("ns3::LteSpectrumPhy::CtrlErrorModelEnabled", BooleanValue(true));
-    Config::SetDefault("ns3::LteSpectrumPhy::DataErrorModelEnabled", BooleanValue(true));
-    Config::SetDefault("ns3::LteHelper::UseIdealRrc", BooleanValue(true));
-    Config::SetDefault("ns3::LteHelper::UsePdschForCqiGeneration", BooleanValue(true));
-
-    // Uplink Power Control
-    Config::SetDefault("ns3::LteUePhy::EnableUplinkPowerControl", BooleanValue(true));
-    Config::SetDefault("ns3::LteUePowerControl::ClosedLoop", BooleanValue(true));
-    Config::SetDefault("ns3::LteUePowerControl::AccumulationEnabled", BooleanValue(false));
-
-    uint32_t runId = 3;
-    uint16_t numberOfRandomUes = 0;
-    double simTime = 2.500;
-    bool generateSpectrumTrace = false;
-    bool generateRem = false;
-    int32_t remRbId = -1;
-    uint16_t bandwidth = 25;
-    double distance = 1000;
-    Box macroUeBox =
-        Box(-distance * 0.5, distance * 1.5, -distance * 0.5, distance * 1.5, 1.5, 1.5);
-
-    // Command line arguments   명령행 인수 처리
-    CommandLine cmd(__FILE__);
-    cmd.AddValue("numberOfUes", "Number of random UEs", numberOfRandomUes);                             // 랜덤 UE의 수
-    cmd.AddValue("simTime", "Total duration of the simulation (in seconds)", simTime);                  // 시뮬레이션의 총 시간 (초 단위)
-    cmd.AddValue("generateSpectrumTrace",
-                 "if true, will generate a Spectrum Analyzer trace",                                    // true로 설정하면 Spectrum Analyzer 추적을 생성합니다.
-                 generateSpectrumTrace);
-    cmd.AddValue("generateRem",
-                 "if true, will generate a REM and then abort the simulation",                          // true로 설정하면 REM을 생성하고 시뮬레이션을 중단합니다.
-                 generateRem);
-    cmd.AddValue("remRbId",
-                 "Resource Block Id, for which REM will be generated,"
-                 "default value is -1, what means REM will be averaged from all RBs",                   // REM을 생성할 리소스 블록 ID, 기본값은 -1로
-                 remRbId);                                                                              // 모든 RB에서 REM을 평균화합니다.
-    cmd.AddValue("runId", "runId", runId);
-    cmd.Parse(argc, argv);
-
-    RngSeedManager::SetSeed(1);
-    RngSeedManager::SetRun(runId);
+    // tag appended to the output files when several runs are simulated                                 여러 실행을 시뮬레이션할 때 출력 파일에 붙이는 태그
+    std::ostringstream tag;
+    if (nRuns > 1)
+    {
+        tag << "_rngRun" << std::setw(3) << std::setfill('0') << run;
+    }
 
     Ptr<LteHelper> lteHelper = CreateObject<LteHelper>();
 
@@ -309,6 +291,13 @@ main(int argc, char* argv[])
     centerUeDevs = lteHelper->InstallUeDevice(centerUeNodes);
     randomUeDevs = lteHelper->InstallUeDevice(randomUeNodes);
 
+    // Index the devices for the Gnuplot printers                                                       Gnuplot 출력 함수를 위해 장치 색인
+    LteDeviceRegistry devices;
+    devices.Add(enbDevs);
+    devices.Add(edgeUeDevs);
+    devices.Add(centerUeDevs);
+    devices.Add(randomUeDevs);
+
     // Attach edge UEs to eNbs                                                                          엣지 UE를 eNbs에 연결
     for (uint32_t i = 0; i < edgeUeDevs.GetN(); i++)
     {
@@ -321,7 +310,7 @@ main(int argc, char* argv[])
     }
 
     // Attach UE to a eNB                                                                               UE를 eNB에 연결
-    lteHelper->AttachToClosestEnb(randomUeDevs, enbDevs);
+    AttachToClosestEnbIndexed(lteHelper, randomUeDevs, enbDevs);
 
     // Activate a data radio bearer                                                                     데이터 라디오 베어러 활성화
     EpsBearer::Qci q = EpsBearer::GBR_CONV_VOICE;
@@ -361,19 +350,20 @@ main(int argc, char* argv[])
         spectrumAnalyzerHelper.SetPhyAttribute("Resolution", TimeValue(MicroSeconds(10)));
         spectrumAnalyzerHelper.SetPhyAttribute("NoisePowerSpectralDensity",
                                                DoubleValue(1e-15));                                     // -120 dBm/Hz
-        spectrumAnalyzerHelper.EnableAsciiAll("spectrum-analyzer-output");
+        spectrumAnalyzerHelper.EnableAsciiAll("spectrum-analyzer-output" + tag.str());
         spectrumAnalyzerHelper.Install(spectrumAnalyzerNodes);
     }
 
     Ptr<RadioEnvironmentMapHelper> remHelper;
     if (generateRem)
     {
-        PrintGnuplottableEnbListToFile("enbs.txt");
-        PrintGnuplottableUeListToFile("ues.txt");
+        PrintGnuplottableEnbListToFile("enbs" + tag.str() + ".txt", devices);
+        PrintGnuplottableUeListToFile("ues" + tag.str() + ".txt", devices);
 
         remHelper = CreateObject<RadioEnvironmentMapHelper>();
         remHelper->SetAttribute("ChannelPath", StringValue("/ChannelList/0"));
-        remHelper->SetAttribute("OutputFile", StringValue("lena-frequency-reuse.rem"));
+        remHelper->SetAttribute("OutputFile",
+                                StringValue("lena-frequency-reuse" + tag.str() + ".rem"));
         remHelper->SetAttribute("XMin", DoubleValue(macroUeBox.xMin));
         remHelper->SetAttribute("XMax", DoubleValue(macroUeBox.xMax));
         remHelper->SetAttribute("YMin", DoubleValue(macroUeBox.yMin));
@@ -386,6 +376,7 @@ main(int argc, char* argv[])
             remHelper->SetAttribute("UseDataChannel", BooleanValue(true));
             remHelper->SetAttribute("RbId", IntegerValue(remRbId));
         }
+        ConfigureRemTile(remHelper, remTiles, remTileId);
 
         remHelper->Install();
         // simulation will stop right after the REM has been generated                                  시뮬레이션은 REM이 생성된 직후에 중지됩니다.
@@ -396,6 +387,75 @@ main(int argc, char* argv[])
     }
 
     Simulator::Run();
-    Simulator::Destroy();
+}
+
+int
+main(int argc, char* argv[])
+{
+    Config::SetDefault("ns3::LteSpectrumPhy::CtrlErrorModelEnabled", BooleanValue(true));
+    Config::SetDefault("ns3::LteSpectrumPhy::DataErrorModelEnabled", BooleanValue(true));
+    Config::SetDefault("ns3::LteHelper::UseIdealRrc", BooleanValue(true));
+    Config::SetDefault("ns3::LteHelper::UsePdschForCqiGeneration", BooleanValue(true));
+
+    // Uplink Power Control
+    Config::SetDefault("ns3::LteUePhy::EnableUplinkPowerControl", BooleanValue(true));
+    Config::SetDefault("ns3::LteUePowerControl::ClosedLoop", BooleanValue(true));
+    Config::SetDefault("ns3::LteUePowerControl::AccumulationEnabled", BooleanValue(false));
+
+    uint32_t runId = 3;
+    uint32_t nRuns = 1;
+    uint16_t numberOfRandomUes = 0;
+    double simTime = 2.500;
+    bool generateSpectrumTrace = false;
+    bool generateRem = false;
+    int32_t remRbId = -1;
+    uint32_t remTiles = 1;
+    uint32_t remTileId = 0;
+    uint16_t bandwidth = 25;
+    double distance = 1000;
+    Box macroUeBox =
+        Box(-distance * 0.5, distance * 1.5, -distance * 0.5, distance * 1.5, 1.5, 1.5);
+
+    // Command line arguments   명령행 인수 처리
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("numberOfUes", "Number of random UEs", numberOfRandomUes);                             // 랜덤 UE의 수
+    cmd.AddValue("simTime", "Total duration of the simulation (in seconds)", simTime);                  // 시뮬레이션의 총 시간 (초 단위)
+    cmd.AddValue("generateSpectrumTrace",
+                 "if true, will generate a Spectrum Analyzer trace",                                    // true로 설정하면 Spectrum Analyzer 추적을 생성합니다.
+                 generateSpectrumTrace);
+    cmd.AddValue("generateRem",
+                 "if true, will generate a REM and then abort the simulation",                          // true로 설정하면 REM을 생성하고 시뮬레이션을 중단합니다.
+                 generateRem);
+    cmd.AddValue("remRbId",
+                 "Resource Block Id, for which REM will be generated,"
+                 "default value is -1, what means REM will be averaged from all RBs",                   // REM을 생성할 리소스 블록 ID, 기본값은 -1로
+                 remRbId);                                                                              // 모든 RB에서 REM을 평균화합니다.
+    cmd.AddValue("remTiles",
+                 "Number of tiles the REM grid is split into; each tile can be "
+                 "computed by a separate process",                                                      // REM 그리드를 나눌 타일 수
+                 remTiles);                                                                             // 각 타일은 별도의 프로세스에서 계산할 수 있습니다.
+    cmd.AddValue("remTileId", "REM tile computed by this run", remTileId);                              // 이번 실행에서 계산할 REM 타일
+    cmd.AddValue("runId", "runId", runId);
+    cmd.AddValue("nRuns", "number of consecutive runIds simulated in this process", nRuns);             // 이 프로세스에서 실행할 연속된 runId의 수
+    cmd.Parse(argc, argv);
+
+    RngSeedManager::SetSeed(1);
+    RngSeedManager::SetRun(runId);
+
+    RunBatch(nRuns, [&](uint64_t run) {
+        RunOnce(run,
+                nRuns,
+                numberOfRandomUes,
+                simTime,
+                generateSpectrumTrace,
+                generateRem,
+                remRbId,
+                remTiles,
+                remTileId,
+                bandwidth,
+                distance,
+                macroUeBox);
+    });
+
     return 0;
 }
@@ -0,0 +1,732 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef LENA_LTE_BINARY_TRACES_H
+#define LENA_LTE_BINARY_TRACES_H
+
+#include "lena-binary-record-writer.h"
+
+#include <ns3/abort.h>
+#include <ns3/component-carrier-enb.h>
+#include <ns3/lte-common.h>
+#include <ns3/lte-enb-mac.h>
+#include <ns3/lte-enb-net-device.h>
+#include <ns3/lte-enb-rrc.h>
+#include <ns3/lte-radio-bearer-info.h>
+#include <ns3/lte-ue-net-device.h>
+#include <ns3/lte-ue-rrc.h>
+#include <ns3/node-list.h>
+#include <ns3/nstime.h>
+#include <ns3/object-map.h>
+#include <ns3/pointer.h>
+#include <ns3/simulator.h>
+
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <set>
+#include <string>
+#include <tuple>
+
+namespace ns3
+{
+
+/// Magic string at the beginning of a binary LTE trace file                                            이진 LTE 트레이스 파일의 시작에 있는 매직 문자열
+static const char LTE_TRACE_MAGIC[8] = {'L', 'T', 'E', 'T', 'R', 'A', 'C', 'E'};
+
+/// Header of a binary LTE trace file                                                                   이진 LTE 트레이스 파일의 헤더
+struct LteTraceFileHeader
+{
+    char magic[8];         ///< LTE_TRACE_MAGIC
+    uint32_t version;      ///< format version
+    uint32_t recordSize;   ///< sizeof(LteTraceRecord)
+    int64_t startTime;     ///< start of the RLC/PDCP statistics [ns]
+    int64_t epochDuration; ///< epoch of the RLC/PDCP statistics [ns]
+};
+
+/// Record of a binary LTE trace file, one per MAC scheduling decision or RLC/PDCP PDU                  MAC 스케줄링 결정 또는 RLC/PDCP PDU마다 하나씩 기록되는 레코드
+struct LteTraceRecord
+{
+    /// Kind of record, i.e., the text file it belongs to                                               레코드의 종류 (해당하는 텍스트 파일)
+    enum Type : uint8_t
+    {
+        DL_MAC = 0, ///< DlMacStats.txt
+        UL_MAC,     ///< UlMacStats.txt
+        DL_RLC_TX,  ///< DlRlcStats.txt, PDU sent by the eNB
+        DL_RLC_RX,  ///< DlRlcStats.txt, PDU received by the UE
+        UL_RLC_TX,  ///< UlRlcStats.txt, PDU sent by the UE
+        UL_RLC_RX,  ///< UlRlcStats.txt, PDU received by the eNB
+        DL_PDCP_TX, ///< DlPdcpStats.txt, PDU sent by the eNB
+        DL_PDCP_RX, ///< DlPdcpStats.txt, PDU received by the UE
+        UL_PDCP_TX, ///< UlPdcpStats.txt, PDU sent by the UE
+        UL_PDCP_RX, ///< UlPdcpStats.txt, PDU received by the eNB
+        NUM_TYPES   ///< number of record types
+    };
+
+    int64_t time;        ///< simulation time [ns]
+    uint64_t imsi;       ///< IMSI, 0 if unknown
+    uint64_t delay;      ///< PDU delay [ns], RX records of RLC and PDCP
+    uint32_t frameNo;    ///< frame number, MAC records
+    uint32_t size;       ///< TB size (first TB in DL) for MAC, PDU size for RLC and PDCP
+    uint16_t size2;      ///< second TB size, DL MAC
+    uint16_t cellId;     ///< cell ID
+    uint16_t rnti;       ///< RNTI
+    uint8_t type;        ///< LteTraceRecord::Type
+    uint8_t subframeNo;  ///< subframe number, MAC records
+    uint8_t mcs;         ///< MCS (first TB in DL), MAC records
+    uint8_t mcs2;        ///< MCS of the second TB, DL MAC
+    uint8_t lcid;        ///< LCID for RLC and PDCP, component carrier ID for MAC
+    uint8_t reserved[5]; ///< padding, always 0
+};
+
+static_assert(sizeof(LteTraceRecord) == 48, "unexpected LteTraceRecord layout");
+
+/**
+ * Binary alternative to LteHelper::EnableMacTraces(), EnableRlcTraces() and                            LteHelper::EnableMacTraces(), EnableRlcTraces(), EnablePdcpTraces()의
+ * EnablePdcpTraces().                                                                                  이진 대안
+ *
+ * The text statistics format every MAC scheduling decision and gather every                            텍스트 통계는 모든 MAC 스케줄링 결정을 iostream으로 서식화하고
+ * RLC/PDCP PDU through iostream and Config path lookups. Here the same trace                           모든 RLC/PDCP PDU를 Config 경로 탐색으로 수집합니다. 여기서는 같은
+ * sources are connected directly on the objects, each event becomes a fixed-size                       트레이스 소스를 객체에 직접 연결하고, 각 이벤트는 고정 크기
+ * LteTraceRecord and the records are written by a BinaryRecordWriter thread.                           LteTraceRecord가 되어 BinaryRecordWriter 스레드가 기록합니다.
+ * lena-lte-trace-converter rebuilds DlMacStats.txt, UlMacStats.txt,                                    lena-lte-trace-converter는 이 파일로부터 DlMacStats.txt, UlMacStats.txt,
+ * DlRlcStats.txt, UlRlcStats.txt, DlPdcpStats.txt and UlPdcpStats.txt from the                         DlRlcStats.txt, UlRlcStats.txt, DlPdcpStats.txt, UlPdcpStats.txt를
+ * file, with the layout of MacStatsCalculator and RadioBearerStatsCalculator.                          MacStatsCalculator 및 RadioBearerStatsCalculator와 같은 형식으로 다시 만듭니다.
+ *
+ * As for LteHelper, the Enable methods are to be called once the devices are                           LteHelper와 마찬가지로 Enable 메서드는 장치를 설치한 뒤 호출해야 하며,
+ * installed, and the object must outlive Simulator::Run(); Close() (or the                             이 객체는 Simulator::Run()보다 오래 살아 있어야 합니다. 남은 레코드는
+ * destructor) writes the pending records.                                                              Close() (또는 소멸자)가 기록합니다.
+ */
+class LteBinaryTraces
+{
+  public:
+    LteBinaryTraces() = default;
+
+    ~LteBinaryTraces()
+    {
+        Close();
+    }
+
+    LteBinaryTraces(const LteBinaryTraces&) = delete;
+    LteBinaryTraces& operator=(const LteBinaryTraces&) = delete;
+
+    /**
+     * \param fileName the output file name, "LteTraces.bin" by default                                 출력 파일 이름 (기본값 "LteTraces.bin")
+     */
+    void SetOutputFilename(std::string fileName)
+    {
+        NS_ABORT_MSG_IF(m_writer.IsOpen(), "the output file is already open");
+        m_fileName = fileName;
+    }
+
+    /**
+     * Set the epochs used by the converter for the RLC and PDCP statistics,                            변환기가 RLC 및 PDCP 통계에 사용할 에포크를 설정합니다.
+     * as the StartTime and EpochDuration attributes of RadioBearerStatsCalculator.                     RadioBearerStatsCalculator의 StartTime 및 EpochDuration 속성과 같습니다.
+     *
+     * \param startTime the start time of the statistics                                                통계 시작 시간
+     * \param epochDuration the epoch duration                                                          에포크 길이
+     */
+    void SetEpoch(Time startTime, Time epochDuration)
+    {
+        NS_ABORT_MSG_IF(m_writer.IsOpen(), "the output file is already open");
+        m_startTime = startTime;
+        m_epochDuration = epochDuration;
+    }
+
+    /// Enable the MAC, RLC and PDCP traces                                                             MAC, RLC, PDCP 트레이스를 활성화합니다.
+    void EnableTraces()
+    {
+        EnableMacTraces();
+        EnableRlcTraces();
+        EnablePdcpTraces();
+    }
+
+    /// Enable the MAC traces of all the eNBs                                                           모든 eNB의 MAC 트레이스를 활성화합니다.
+    void EnableMacTraces()
+    {
+        NS_ABORT_MSG_IF(m_mac, "MAC traces already enabled");
+        m_mac = true;
+        Open();
+        for (auto it = NodeList::Begin(); it != NodeList::End(); ++it)
+        {
+            for (uint32_t j = 0; j < (*it)->GetNDevices(); ++j)
+            {
+                Ptr<LteEnbNetDevice> enbDev = (*it)->GetDevice(j)->GetObject<LteEnbNetDevice>();
+                if (!enbDev)
+                {
+                    continue;
+                }
+                for (const auto& cc : enbDev->GetCcMap())
+                {
+                    Ptr<ComponentCarrierEnb> ccEnb = DynamicCast<ComponentCarrierEnb>(cc.second);
+                    uint16_t cellId = ccEnb->GetCellId();
+                    ccEnb->GetMac()->TraceConnectWithoutContext(
+                        "DlScheduling",
+                        MakeBoundCallback(&LteBinaryTraces::DlScheduling,
+                                          this,
+                                          enbDev->GetRrc(),
+                                          cellId));
+                    ccEnb->GetMac()->TraceConnectWithoutContext(
+                        "UlScheduling",
+                        MakeBoundCallback(&LteBinaryTraces::UlScheduling,
+                                          this,
+                                          enbDev->GetRrc(),
+                                          cellId));
+                }
+            }
+        }
+    }
+
+    /// Enable the RLC traces of all the radio bearers                                                  모든 무선 베어러의 RLC 트레이스를 활성화합니다.
+    void EnableRlcTraces()
+    {
+        NS_ABORT_MSG_IF(m_rlc, "RLC traces already enabled");
+        m_rlc = true;
+        Open();
+        ConnectRrcTraces();
+    }
+
+    /// Enable the PDCP traces of all the radio bearers                                                 모든 무선 베어러의 PDCP 트레이스를 활성화합니다.
+    void EnablePdcpTraces()
+    {
+        NS_ABORT_MSG_IF(m_pdcp, "PDCP traces already enabled");
+        m_pdcp = true;
+        Open();
+        ConnectRrcTraces();
+    }
+
+    /// Write the pending records and close the file                                                    남은 레코드를 기록하고 파일을 닫습니다.
+    void Close()
+    {
+        m_writer.Close();
+    }
+
+  private:
+    /// Open the output file, if not done yet                                                           아직 열지 않았다면 출력 파일을 엽니다.
+    void Open()
+    {
+        if (m_writer.IsOpen())
+        {
+            return;
+        }
+        LteTraceFileHeader header;
+        std::memset(&header, 0, sizeof(header));
+        std::memcpy(header.magic, LTE_TRACE_MAGIC, sizeof(header.magic));
+        header.version = 1;
+        header.recordSize = sizeof(LteTraceRecord);
+        header.startTime = m_startTime.GetNanoSeconds();
+        header.epochDuration = m_epochDuration.GetNanoSeconds();
+        m_writer.Open(m_fileName, header);
+    }
+
+    /**
+     * The radio bearers are created along the RRC procedures, hence their RLC and PDCP                 무선 베어러는 RRC 절차에 따라 생성되므로, RLC 및 PDCP 트레이스는
+     * traces are connected whenever a procedure that may have created one completes,                   베어러를 생성했을 수 있는 절차가 끝날 때마다 연결합니다.
+     * as RadioBearerStatsConnector does.                                                               (RadioBearerStatsConnector와 같은 방식)
+     */
+    void ConnectRrcTraces()
+    {
+        if (m_rrcConnected)
+        {
+            return;
+        }
+        m_rrcConnected = true;
+        for (auto it = NodeList::Begin(); it != NodeList::End(); ++it)
+        {
+            for (uint32_t j = 0; j < (*it)->GetNDevices(); ++j)
+            {
+                Ptr<NetDevice> dev = (*it)->GetDevice(j);
+                if (Ptr<LteEnbNetDevice> enbDev = dev->GetObject<LteEnbNetDevice>())
+                {
+                    Ptr<LteEnbRrc> rrc = enbDev->GetRrc();
+                    rrc->TraceConnectWithoutContext(
+                        "NewUeContext",
+                        MakeBoundCallback(&LteBinaryTraces::NotifyNewUeContextEnb, this, enbDev));
+                    for (const auto& name :
+                         {"ConnectionEstablished", "ConnectionReconfiguration", "HandoverEndOk"})
+                    {
+                        rrc->TraceConnectWithoutContext(
+                            name,
+                            MakeBoundCallback(&LteBinaryTraces::NotifyRrcEnb, this, enbDev));
+                    }
+                }
+                else if (Ptr<LteUeNetDevice> ueDev = dev->GetObject<LteUeNetDevice>())
+                {
+                    for (const auto& name : {"RandomAccessSuccessful",
+                                             "ConnectionEstablished",
+                                             "ConnectionReconfiguration",
+                                             "HandoverEndOk"})
+                    {
+                        ueDev->GetRrc()->TraceConnectWithoutContext(
+                            name,
+                            MakeBoundCallback(&LteBinaryTraces::NotifyRrcUe, this, ueDev));
+                    }
+                }
+            }
+        }
+    }
+
+    /// TxPDU sink of the RLC and PDCP entities                                                         RLC 및 PDCP 개체의 TxPDU 싱크
+    using TxPduCallback = Callback<void, uint16_t, uint8_t, uint32_t>;
+    /// RxPDU sink of the RLC and PDCP entities                                                         RLC 및 PDCP 개체의 RxPDU 싱크
+    using RxPduCallback = Callback<void, uint16_t, uint8_t, uint32_t, uint64_t>;
+
+    /// Sinks of the RLC and PDCP traces of the bearers of a UE context or a UE                         UE 컨텍스트 또는 UE 베어러의 RLC 및 PDCP 트레이스 싱크
+    struct BearerSinks
+    {
+        TxPduCallback rlcTx;  ///< TxPDU sink of the RLC entities
+        RxPduCallback rlcRx;  ///< RxPDU sink of the RLC entities
+        TxPduCallback pdcpTx; ///< TxPDU sink of the PDCP entities
+        RxPduCallback pdcpRx; ///< RxPDU sink of the PDCP entities
+    };
+
+    /**
+     * Radio bearer whose traces are connected, identified as in RadioBearerStatsConnector.             RadioBearerStatsConnector에서와 같이 식별한, 트레이스가 연결된 무선 베어러
+     * The keys are sorted by cell and RNTI first, so that the bearers of a UE context are              키는 셀과 RNTI 순으로 먼저 정렬되어 UE 컨텍스트의 베어러들이
+     * contiguous.                                                                                      연속으로 놓입니다.
+     */
+    struct BearerKey
+    {
+        uint64_t imsi;   ///< IMSI
+        uint16_t cellId; ///< cell ID
+        uint16_t rnti;   ///< RNTI
+        uint8_t lcid;    ///< LCID
+
+        /**
+         * \param other another key                                                                     다른 키
+         * \return true if this key is before the other one                                             이 키가 다른 키보다 앞이면 참
+         */
+        bool operator<(const BearerKey& other) const
+        {
+            return std::tie(cellId, rnti, imsi, lcid) <
+                   std::tie(other.cellId, other.rnti, other.imsi, other.lcid);
+        }
+    };
+
+    /**
+     * Connect the RLC and PDCP traces of a radio bearer, unless already connected.                     이미 연결되지 않았다면 무선 베어러의 RLC 및 PDCP 트레이스를 연결합니다.
+     *
+     * \param connected the bearers already connected                                                   이미 연결된 베어러들
+     * \param key the bearer key                                                                        베어러 키
+     * \param bearer the bearer, possibly not created yet                                               베어러 (아직 생성되지 않았을 수 있음)
+     * \param sinks the trace sinks                                                                     트레이스 싱크
+     */
+    void ConnectBearer(std::set<BearerKey>& connected,
+                       const BearerKey& key,
+                       Ptr<LteRadioBearerInfo> bearer,
+                       const BearerSinks& sinks)
+    {
+        if (!bearer || !connected.insert(key).second)
+        {
+            return;
+        }
+        if (m_rlc && bearer->m_rlc)
+        {
+            bearer->m_rlc->TraceConnectWithoutContext("TxPDU", sinks.rlcTx);
+            bearer->m_rlc->TraceConnectWithoutContext("RxPDU", sinks.rlcRx);
+        }
+        if (m_pdcp && bearer->m_pdcp)
+        {
+            bearer->m_pdcp->TraceConnectWithoutContext("TxPDU", sinks.pdcpTx);
+            bearer->m_pdcp->TraceConnectWithoutContext("RxPDU", sinks.pdcpRx);
+        }
+    }
+
+    /**
+     * \param owner the UeManager or the LteUeRrc                                                       UeManager 또는 LteUeRrc
+     * \param name the name of the attribute, "Srb0" or "Srb1"                                          속성 이름 ("Srb0" 또는 "Srb1")
+     * \return the signalling radio bearer, null if not created yet                                     시그널링 무선 베어러 (아직 생성되지 않았으면 null)
+     */
+    static Ptr<LteRadioBearerInfo> GetSrb(Ptr<Object> owner, const std::string& name)
+    {
+        PointerValue srb;
+        owner->GetAttribute(name, srb);
+        return srb.Get<LteRadioBearerInfo>();
+    }
+
+    /**
+     * Connect the traces of the data radio bearers of a UeManager or a LteUeRrc.                       UeManager 또는 LteUeRrc의 데이터 무선 베어러 트레이스를 연결합니다.
+     *
+     * \param connected the bearers already connected                                                   이미 연결된 베어러들
+     * \param key the key of the bearers, whose LCID is set here                                        베어러 키 (LCID는 여기서 설정)
+     * \param owner the UeManager or the LteUeRrc                                                       UeManager 또는 LteUeRrc
+     * \param sinks the trace sinks                                                                     트레이스 싱크
+     */
+    void ConnectDrbs(std::set<BearerKey>& connected,
+                     BearerKey key,
+                     Ptr<Object> owner,
+                     const BearerSinks& sinks)
+    {
+        ObjectMapValue drbs;
+        owner->GetAttribute("DataRadioBearerMap", drbs);
+        for (auto it = drbs.Begin(); it != drbs.End(); ++it)
+        {
+            Ptr<LteDataRadioBearerInfo> drb = DynamicCast<LteDataRadioBearerInfo>(it->second);
+            key.lcid = drb->m_logicalChannelIdentity;
+            ConnectBearer(connected, key, drb, sinks);
+        }
+    }
+
+    /**
+     * Connect the RLC and PDCP traces of the bearers of a UE context at the eNB.                       eNB에 있는 UE 컨텍스트의 베어러에 대한 RLC 및 PDCP 트레이스를 연결합니다.
+     *
+     * The signalling radio bearers are created with the context, before the IMSI is                    시그널링 무선 베어러는 IMSI를 알기 전에 컨텍스트와 함께 생성되므로
+     * known, hence they are only connected for a new context; the keys left by a                       새 컨텍스트에 대해서만 연결합니다. 같은 셀과 RNTI의 이전 컨텍스트가
+     * previous context of the same cell and RNTI are dropped then.                                     남긴 키는 이때 제거합니다.
+     *
+     * \param enbDev the eNB device                                                                     eNB 장치
+     * \param cellId the cell ID                                                                        셀 ID
+     * \param rnti the RNTI of the UE context                                                           UE 컨텍스트의 RNTI
+     * \param newContext whether the context has just been created                                      컨텍스트가 방금 생성되었는지 여부
+     */
+    void ConnectEnbBearers(Ptr<LteEnbNetDevice> enbDev,
+                           uint16_t cellId,
+                           uint16_t rnti,
+                           bool newContext)
+    {
+        Ptr<LteEnbRrc> rrc = enbDev->GetRrc();
+        if (!rrc->HasUeManager(rnti))
+        {
+            return;
+        }
+        Ptr<UeManager> ueManager = rrc->GetUeManager(rnti);
+        BearerSinks sinks{
+            MakeBoundCallback(&LteBinaryTraces::EnbTxPdu,
+                              this,
+                              LteTraceRecord::DL_RLC_TX,
+                              rrc,
+                              cellId),
+            MakeBoundCallback(&LteBinaryTraces::EnbRxPdu,
+                              this,
+                              LteTraceRecord::UL_RLC_RX,
+                              rrc,
+                              cellId),
+            MakeBoundCallback(&LteBinaryTraces::EnbTxPdu,
+                              this,
+                              LteTraceRecord::DL_PDCP_TX,
+                              rrc,
+                              cellId),
+            MakeBoundCallback(&LteBinaryTraces::EnbRxPdu,
+                              this,
+                              LteTraceRecord::UL_PDCP_RX,
+                              rrc,
+                              cellId),
+        };
+        BearerKey key{ueManager->GetImsi(), cellId, rnti, 0};
+        if (newContext)
+        {
+            auto it = m_enbBearers.lower_bound(key);
+            while (it != m_enbBearers.end() && it->cellId == cellId && it->rnti == rnti)
+            {
+                it = m_enbBearers.erase(it);
+            }
+            ConnectBearer(m_enbBearers, key, GetSrb(ueManager, "Srb0"), sinks);
+            key.lcid = 1;
+            ConnectBearer(m_enbBearers, key, GetSrb(ueManager, "Srb1"), sinks);
+        }
+        ConnectDrbs(m_enbBearers, key, ueManager, sinks);
+    }
+
+    /**
+     * Connect the RLC and PDCP traces of the bearers of a UE.                                          UE 베어러의 RLC 및 PDCP 트레이스를 연결합니다.
+     *
+     * SRB0 lives as long as the UE, hence its key has no cell nor RNTI; SRB1 and the                   SRB0은 UE와 수명이 같으므로 키에 셀과 RNTI가 없습니다. SRB1과 데이터
+     * data radio bearers are created again on each connection and handover.                            무선 베어러는 연결 및 핸드오버마다 다시 생성됩니다.
+     *
+     * \param ueDev the UE device                                                                       UE 장치
+     * \param cellId the cell ID                                                                        셀 ID
+     * \param rnti the RNTI                                                                             RNTI
+     */
+    void ConnectUeBearers(Ptr<LteUeNetDevice> ueDev, uint16_t cellId, uint16_t rnti)
+    {
+        Ptr<LteUeRrc> rrc = ueDev->GetRrc();
+        BearerSinks sinks{
+            MakeBoundCallback(&LteBinaryTraces::UeTxPdu, this, LteTraceRecord::UL_RLC_TX, rrc),
+            MakeBoundCallback(&LteBinaryTraces::UeRxPdu, this, LteTraceRecord::DL_RLC_RX, rrc),
+            MakeBoundCallback(&LteBinaryTraces::UeTxPdu, this, LteTraceRecord::UL_PDCP_TX, rrc),
+            MakeBoundCallback(&LteBinaryTraces::UeRxPdu, this, LteTraceRecord::DL_PDCP_RX, rrc),
+        };
+        ConnectBearer(m_ueBearers, BearerKey{rrc->GetImsi(), 0, 0, 0}, GetSrb(rrc, "Srb0"), sinks);
+        BearerKey key{rrc->GetImsi(), cellId, rnti, 1};
+        ConnectBearer(m_ueBearers, key, GetSrb(rrc, "Srb1"), sinks);
+        ConnectDrbs(m_ueBearers, key, rrc, sinks);
+    }
+
+    /**
+     * \param rrc the eNB RRC                                                                           eNB RRC
+     * \param rnti the RNTI                                                                             RNTI
+     * \return the IMSI of the UE with the given RNTI, 0 if unknown                                     주어진 RNTI를 가진 UE의 IMSI (알 수 없으면 0)
+     */
+    static uint64_t GetImsi(Ptr<LteEnbRrc> rrc, uint16_t rnti)
+    {
+        return rrc->HasUeManager(rnti) ? rrc->GetUeManager(rnti)->GetImsi() : 0;
+    }
+
+    /**
+     * \param type the record type                                                                      레코드 종류
+     * \return a zeroed record of the given type, stamped with the current time                         현재 시간이 기록된, 주어진 종류의 0으로 초기화된 레코드
+     */
+    static LteTraceRecord NewRecord(LteTraceRecord::Type type)
+    {
+        LteTraceRecord record;
+        std::memset(&record, 0, sizeof(record));
+        record.time = Simulator::Now().GetNanoSeconds();
+        record.type = type;
+        return record;
+    }
+
+    /**
+     * Sink of the DlScheduling trace of LteEnbMac.                                                     LteEnbMac의 DlScheduling 트레이스 싱크
+     *
+     * \param traces the LteBinaryTraces                                                                LteBinaryTraces 객체
+     * \param rrc the RRC of the eNB                                                                    eNB의 RRC
+     * \param cellId the cell ID of the component carrier                                               컴포넌트 캐리어의 셀 ID
+     * \param info the scheduling decision                                                              스케줄링 결정
+     */
+    static void DlScheduling(LteBinaryTraces* traces,
+                             Ptr<LteEnbRrc> rrc,
+                             uint16_t cellId,
+                             DlSchedulingCallbackInfo info)
+    {
+        LteTraceRecord record = NewRecord(LteTraceRecord::DL_MAC);
+        record.imsi = GetImsi(rrc, info.rnti);
+        record.frameNo = info.frameNo;
+        record.subframeNo = info.subframeNo;
+        record.rnti = info.rnti;
+        record.cellId = cellId;
+        record.mcs = info.mcsTb1;
+        record.size = info.sizeTb1;
+        record.mcs2 = info.mcsTb2;
+        record.size2 = info.sizeTb2;
+        record.lcid = info.componentCarrierId;
+        traces->m_writer.Write(record);
+    }
+
+    /**
+     * Sink of the UlScheduling trace of LteEnbMac.                                                     LteEnbMac의 UlScheduling 트레이스 싱크
+     *
+     * \param traces the LteBinaryTraces                                                                LteBinaryTraces 객체
+     * \param rrc the RRC of the eNB                                                                    eNB의 RRC
+     * \param cellId the cell ID of the component carrier                                               컴포넌트 캐리어의 셀 ID
+     * \param frameNo the frame number                                                                  프레임 번호
+     * \param subframeNo the subframe number                                                            서브프레임 번호
+     * \param rnti the RNTI                                                                             RNTI
+     * \param mcs the MCS                                                                               MCS
+     * \param size the TB size                                                                          TB 크기
+     * \param componentCarrierId the component carrier ID                                               컴포넌트 캐리어 ID
+     */
+    static void UlScheduling(LteBinaryTraces* traces,
+                             Ptr<LteEnbRrc> rrc,
+                             uint16_t cellId,
+                             uint32_t frameNo,
+                             uint32_t subframeNo,
+                             uint16_t rnti,
+                             uint8_t mcs,
+                             uint16_t size,
+                             uint8_t componentCarrierId)
+    {
+        LteTraceRecord record = NewRecord(LteTraceRecord::UL_MAC);
+        record.imsi = GetImsi(rrc, rnti);
+        record.frameNo = frameNo;
+        record.subframeNo = subframeNo;
+        record.rnti = rnti;
+        record.cellId = cellId;
+        record.mcs = mcs;
+        record.size = size;
+        record.lcid = componentCarrierId;
+        traces->m_writer.Write(record);
+    }
+
+    /**
+     * Sink of the TxPDU trace of an RLC or PDCP entity at the eNB.                                     eNB에 있는 RLC 또는 PDCP 개체의 TxPDU 트레이스 싱크
+     *
+     * \param traces the LteBinaryTraces                                                                LteBinaryTraces 객체
+     * \param type the record type                                                                      레코드 종류
+     * \param rrc the RRC of the eNB                                                                    eNB의 RRC
+     * \param cellId the cell ID                                                                        셀 ID
+     * \param rnti the RNTI                                                                             RNTI
+     * \param lcid the LCID                                                                             LCID
+     * \param size the PDU size                                                                         PDU 크기
+     */
+    static void EnbTxPdu(LteBinaryTraces* traces,
+                         LteTraceRecord::Type type,
+                         Ptr<LteEnbRrc> rrc,
+                         uint16_t cellId,
+                         uint16_t rnti,
+                         uint8_t lcid,
+                         uint32_t size)
+    {
+        LteTraceRecord record = NewRecord(type);
+        record.imsi = GetImsi(rrc, rnti);
+        record.cellId = cellId;
+        record.rnti = rnti;
+        record.lcid = lcid;
+        record.size = size;
+        traces->m_writer.Write(record);
+    }
+
+    /**
+     * Sink of the RxPDU trace of an RLC or PDCP entity at the eNB.                                     eNB에 있는 RLC 또는 PDCP 개체의 RxPDU 트레이스 싱크
+     *
+     * \param traces the LteBinaryTraces                                                                LteBinaryTraces 객체
+     * \param type the record type                                                                      레코드 종류
+     * \param rrc the RRC of the eNB                                                                    eNB의 RRC
+     * \param cellId the cell ID                                                                        셀 ID
+     * \param rnti the RNTI                                                                             RNTI
+     * \param lcid the LCID                                                                             LCID
+     * \param size the PDU size                                                                         PDU 크기
+     * \param delay the PDU delay [ns]                                                                  PDU 지연 [ns]
+     */
+    static void EnbRxPdu(LteBinaryTraces* traces,
+                         LteTraceRecord::Type type,
+                         Ptr<LteEnbRrc> rrc,
+                         uint16_t cellId,
+                         uint16_t rnti,
+                         uint8_t lcid,
+                         uint32_t size,
+                         uint64_t delay)
+    {
+        LteTraceRecord record = NewRecord(type);
+        record.imsi = GetImsi(rrc, rnti);
+        record.cellId = cellId;
+        record.rnti = rnti;
+        record.lcid = lcid;
+        record.size = size;
+        record.delay = delay;
+        traces->m_writer.Write(record);
+    }
+
+    /**
+     * Sink of the TxPDU trace of an RLC or PDCP entity at the UE.                                      UE에 있는 RLC 또는 PDCP 개체의 TxPDU 트레이스 싱크
+     *
+     * \param traces the LteBinaryTraces                                                                LteBinaryTraces 객체
+     * \param type the record type                                                                      레코드 종류
+     * \param rrc the RRC of the UE                                                                     UE의 RRC
+     * \param rnti the RNTI                                                                             RNTI
+     * \param lcid the LCID                                                                             LCID
+     * \param size the PDU size                                                                         PDU 크기
+     */
+    static void UeTxPdu(LteBinaryTraces* traces,
+                        LteTraceRecord::Type type,
+                        Ptr<LteUeRrc> rrc,
+                        uint16_t rnti,
+                        uint8_t lcid,
+                        uint32_t size)
+    {
+        LteTraceRecord record = NewRecord(type);
+        record.imsi = rrc->GetImsi();
+        record.cellId = rrc->GetCellId();
+        record.rnti = rnti;
+        record.lcid = lcid;
+        record.size = size;
+        traces->m_writer.Write(record);
+    }
+
+    /**
+     * Sink of the RxPDU trace of an RLC or PDCP entity at the UE.                                      UE에 있는 RLC 또는 PDCP 개체의 RxPDU 트레이스 싱크
+     *
+     * \param traces the LteBinaryTraces                                                                LteBinaryTraces 객체
+     * \param type the record type                                                                      레코드 종류
+     * \param rrc the RRC of the UE                                                                     UE의 RRC
+     * \param rnti the RNTI                                                                             RNTI
+     * \param lcid the LCID                                                                             LCID
+     * \param size the PDU size                                                                         PDU 크기
+     * \param delay the PDU delay [ns]                                                                  PDU 지연 [ns]
+     */
+    static void UeRxPdu(LteBinaryTraces* traces,
+                        LteTraceRecord::Type type,
+                        Ptr<LteUeRrc> rrc,
+                        uint16_t rnti,
+                        uint8_t lcid,
+                        uint32_t size,
+                        uint64_t delay)
+    {
+        LteTraceRecord record = NewRecord(type);
+        record.imsi = rrc->GetImsi();
+        record.cellId = rrc->GetCellId();
+        record.rnti = rnti;
+        record.lcid = lcid;
+        record.size = size;
+        record.delay = delay;
+        traces->m_writer.Write(record);
+    }
+
+    /**
+     * Sink of the NewUeContext trace of LteEnbRrc, connecting the signalling radio bearers.            LteEnbRrc의 NewUeContext 트레이스 싱크 (시그널링 무선 베어러 연결)
+     *
+     * \param traces the LteBinaryTraces                                                                LteBinaryTraces 객체
+     * \param enbDev the eNB device                                                                     eNB 장치
+     * \param cellId the cell ID                                                                        셀 ID
+     * \param rnti the RNTI                                                                             RNTI
+     */
+    static void NotifyNewUeContextEnb(LteBinaryTraces* traces,
+                                      Ptr<LteEnbNetDevice> enbDev,
+                                      uint16_t cellId,
+                                      uint16_t rnti)
+    {
+        traces->ConnectEnbBearers(enbDev, cellId, rnti, true);
+    }
+
+    /**
+     * Sink of the eNB RRC procedures that may create bearers.                                          베어러를 생성할 수 있는 eNB RRC 절차의 싱크
+     *
+     * \param traces the LteBinaryTraces                                                                LteBinaryTraces 객체
+     * \param enbDev the eNB device                                                                     eNB 장치
+     * \param imsi the IMSI                                                                             IMSI
+     * \param cellId the cell ID                                                                        셀 ID
+     * \param rnti the RNTI                                                                             RNTI
+     */
+    static void NotifyRrcEnb(LteBinaryTraces* traces,
+                             Ptr<LteEnbNetDevice> enbDev,
+                             uint64_t imsi,
+                             uint16_t cellId,
+                             uint16_t rnti)
+    {
+        traces->ConnectEnbBearers(enbDev, cellId, rnti, false);
+    }
+
+    /**
+     * Sink of the UE RRC procedures that may create bearers.                                           베어러를 생성할 수 있는 UE RRC 절차의 싱크
+     *
+     * \param traces the LteBinaryTraces                                                                LteBinaryTraces 객체
+     * \param ueDev the UE device                                                                       UE 장치
+     * \param imsi the IMSI                                                                             IMSI
+     * \param cellId the cell ID                                                                        셀 ID
+     * \param rnti the RNTI                                                                             RNTI
+     */
+    static void NotifyRrcUe(LteBinaryTraces* traces,
+                            Ptr<LteUeNetDevice> ueDev,
+                            uint64_t imsi,
+                            uint16_t cellId,
+                            uint16_t rnti)
+    {
+        traces->ConnectUeBearers(ueDev, cellId, rnti);
+    }
+
+    BinaryRecordWriter<LteTraceRecord> m_writer; ///< record writer
+    std::string m_fileName{"LteTraces.bin"};     ///< output file name
+    Time m_startTime{Seconds(0)};                ///< start of the RLC/PDCP statistics
+    Time m_epochDuration{Seconds(0.25)};         ///< epoch of the RLC/PDCP statistics
+    bool m_mac{false};                           ///< MAC traces enabled
+    bool m_rlc{false};                           ///< RLC traces enabled
+    bool m_pdcp{false};                          ///< PDCP traces enabled
+    bool m_rrcConnected{false};                  ///< RRC traces connected
+    std::set<BearerKey> m_enbBearers;            ///< bearers of the eNBs already connected
+    std::set<BearerKey> m_ueBearers;             ///< bearers of the UEs already connected
+};
+
+} // namespace ns3
+
+#endif // LENA_LTE_BINARY_TRACES_H
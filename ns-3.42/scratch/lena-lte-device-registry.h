@@ -0,0 +1,133 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef LENA_LTE_DEVICE_REGISTRY_H
+#define LENA_LTE_DEVICE_REGISTRY_H
+
+#include <ns3/abort.h>
+#include <ns3/component-carrier-enb.h>
+#include <ns3/lte-enb-net-device.h>
+#include <ns3/lte-ue-net-device.h>
+#include <ns3/net-device-container.h>
+#include <ns3/node.h>
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * Index of the LTE devices of a simulation by IMSI and by cell ID.                                     IMSI와 셀 ID로 시뮬레이션의 LTE 장치를 찾는 색인
+ *
+ * Finding the UE of an IMSI by walking the NodeList and calling                                        NodeList를 순회하며 모든 장치에 GetObject<LteUeNetDevice>()를 호출하여
+ * GetObject<LteUeNetDevice>() on every device costs O(N) per lookup, which                             IMSI의 UE를 찾으면 조회마다 O(N)이 들며, 이벤트마다 조회하면 비용이
+ * adds up when done on every event. The devices returned by the LteHelper                              누적됩니다. LteHelper가 반환한 장치를 설치 시점에 Add()로 등록하면
+ * installers are registered with Add() as they are installed, and IMSIs and                            IMSI와 셀 ID를 해시 맵으로 O(1)에 찾을 수 있습니다. 등록 순서대로
+ * cell IDs are then found in O(1) through hash maps. The devices are also                              장치 목록도 보관하므로 전체 목록 출력에 NodeList 순회가 필요하지
+ * kept in registration order, so printing all of them needs no NodeList walk.                          않습니다.
+ *
+ * An eNB with several component carriers is found by the cell ID of any of                             여러 구성 반송파를 가진 eNB는 각 반송파의 셀 ID로 모두 찾을 수
+ * its carriers.                                                                                        있습니다.
+ */
+class LteDeviceRegistry
+{
+  public:
+    /// A UE device and its node                                                                        UE 장치와 그 노드
+    struct UeEntry
+    {
+        Ptr<LteUeNetDevice> dev; ///< the device
+        Ptr<Node> node;          ///< the node of the device
+    };
+
+    /// An eNB device and its node                                                                      eNB 장치와 그 노드
+    struct EnbEntry
+    {
+        Ptr<LteEnbNetDevice> dev; ///< the device
+        Ptr<Node> node;           ///< the node of the device
+    };
+
+    /**
+     * Register the devices returned by an LteHelper installer; devices that                            LteHelper 설치 함수가 반환한 장치를 등록합니다. LTE UE나 eNB가
+     * are neither LTE UEs nor eNBs are ignored.                                                        아닌 장치는 무시합니다.
+     *
+     * \param devs the installed devices                                                                설치된 장치들
+     */
+    void Add(const NetDeviceContainer& devs)
+    {
+        for (auto it = devs.Begin(); it != devs.End(); ++it)
+        {
+            if (Ptr<LteUeNetDevice> ueDev = (*it)->GetObject<LteUeNetDevice>())
+            {
+                bool inserted = m_ueIndex.emplace(ueDev->GetImsi(), m_ues.size()).second;
+                NS_ABORT_MSG_IF(!inserted, "IMSI " << ueDev->GetImsi() << " already registered");
+                m_ues.push_back({ueDev, ueDev->GetNode()});
+            }
+            else if (Ptr<LteEnbNetDevice> enbDev = (*it)->GetObject<LteEnbNetDevice>())
+            {
+                for (const auto& cc : enbDev->GetCcMap())
+                {
+                    uint16_t cellId = cc.second->GetCellId();
+                    bool inserted = m_enbIndex.emplace(cellId, m_enbs.size()).second;
+                    NS_ABORT_MSG_IF(!inserted, "cell " << cellId << " already registered");
+                }
+                m_enbs.push_back({enbDev, enbDev->GetNode()});
+            }
+        }
+    }
+
+    /**
+     * \param imsi the IMSI                                                                             IMSI
+     * \return the UE with this IMSI, or nullptr if none is registered                                  이 IMSI의 UE, 등록되지 않았으면 nullptr
+     */
+    const UeEntry* FindUe(uint64_t imsi) const
+    {
+        auto it = m_ueIndex.find(imsi);
+        return it == m_ueIndex.end() ? nullptr : &m_ues[it->second];
+    }
+
+    /**
+     * \param cellId the cell ID                                                                        셀 ID
+     * \return the eNB serving this cell, or nullptr if none is registered                              이 셀을 서비스하는 eNB, 등록되지 않았으면 nullptr
+     */
+    const EnbEntry* FindEnb(uint16_t cellId) const
+    {
+        auto it = m_enbIndex.find(cellId);
+        return it == m_enbIndex.end() ? nullptr : &m_enbs[it->second];
+    }
+
+    /// \return the UEs, in registration order                                                          등록 순서의 UE 목록
+    const std::vector<UeEntry>& GetUes() const
+    {
+        return m_ues;
+    }
+
+    /// \return the eNBs, in registration order                                                         등록 순서의 eNB 목록
+    const std::vector<EnbEntry>& GetEnbs() const
+    {
+        return m_enbs;
+    }
+
+  private:
+    std::vector<UeEntry> m_ues;                           ///< UEs, in registration order
+    std::vector<EnbEntry> m_enbs;                         ///< eNBs, in registration order
+    std::unordered_map<uint64_t, std::size_t> m_ueIndex;  ///< index in m_ues of each IMSI
+    std::unordered_map<uint16_t, std::size_t> m_enbIndex; ///< index in m_enbs of each cell ID
+};
+
+} // namespace ns3
+
+#endif // LENA_LTE_DEVICE_REGISTRY_H
@@ -0,0 +1,193 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "lena-lte-rrc-event-log.h"
+
+#include "ns3/core-module.h"
+#include "ns3/lte-module.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE("LenaLteRrcEventDecoder");
+
+/// Name of each LteRrcEventRecord::Event                                                               LteRrcEventRecord::Event 각각의 이름
+static const char* const g_eventName[LteRrcEventRecord::NUM_EVENTS] = {
+    "UeStateTransition",
+    "UeConnectionEstablished",
+    "UeHandoverStart",
+    "UeHandoverEndOk",
+    "UePhySyncDetection",
+    "UeRadioLinkFailure",
+    "UeRandomAccessError",
+    "UeConnectionTimeout",
+    "UeRaResponseTimeout",
+    "EnbConnectionEstablished",
+    "EnbHandoverStart",
+    "EnbHandoverEndOk",
+    "EnbConnectionRelease",
+    "EnbRrcTimeout",
+};
+
+/// Name of each LteUeRrc::State                                                                        LteUeRrc::State 각각의 이름
+static const char* const g_ueRrcStateName[LteUeRrc::NUM_STATES] = {
+    "IDLE_START",
+    "IDLE_CELL_SEARCH",
+    "IDLE_WAIT_MIB_SIB1",
+    "IDLE_WAIT_MIB",
+    "IDLE_WAIT_SIB1",
+    "IDLE_CAMPED_NORMALLY",
+    "IDLE_WAIT_SIB2",
+    "IDLE_RANDOM_ACCESS",
+    "IDLE_CONNECTING",
+    "CONNECTED_NORMALLY",
+    "CONNECTED_HANDOVER",
+    "CONNECTED_PHY_PROBLEM",
+    "CONNECTED_REESTABLISHING",
+};
+
+/// Strings of the PhySyncDetection trace, per LteRrcEventRecord::SyncType                              LteRrcEventRecord::SyncType별 PhySyncDetection 트레이스 문자열
+static const char* const g_syncName[] = {"Notify out of sync", "Notify in sync", "other"};
+
+/// Strings of the RrcTimeout trace, per LteRrcEventRecord::TimeoutCause                                LteRrcEventRecord::TimeoutCause별 RrcTimeout 트레이스 문자열
+static const char* const g_timeoutName[] = {"ConnectionRequestTimeout",
+                                            "ConnectionSetupTimeout",
+                                            "ConnectionRejectedTimeout",
+                                            "HandoverJoiningTimeout",
+                                            "HandoverLeavingTimeout",
+                                            "other"};
+
+/**
+ * \param state a LteUeRrc::State code                                                                  LteUeRrc::State 코드
+ * \return the name of the state                                                                        상태 이름
+ */
+static const char*
+StateName(uint8_t state)
+{
+    return state < LteUeRrc::NUM_STATES ? g_ueRrcStateName[state] : "?";
+}
+
+/**
+ * Write the arguments of an event, after its common fields.                                            공통 필드 뒤에 이벤트의 인수를 기록합니다.
+ *
+ * \param out the output stream                                                                         출력 스트림
+ * \param r the record                                                                                  레코드
+ */
+static void
+WriteArguments(std::ostream& out, const LteRrcEventRecord& r)
+{
+    switch (r.event)
+    {
+    case LteRrcEventRecord::UE_STATE_TRANSITION:
+        out << StateName(r.arg[0]) << " -> " << StateName(r.arg[1]);
+        break;
+    case LteRrcEventRecord::UE_HANDOVER_START:
+    case LteRrcEventRecord::ENB_HANDOVER_START:
+        out << "target cell " << r.value;
+        break;
+    case LteRrcEventRecord::UE_PHY_SYNC_DETECTION:
+        out << g_syncName[std::min<uint8_t>(r.arg[0], LteRrcEventRecord::OTHER_SYNC)]
+            << ", no of sync indications " << +r.arg[1];
+        break;
+    case LteRrcEventRecord::UE_CONNECTION_TIMEOUT:
+        out << "T300 expiration counter " << +r.arg[0];
+        break;
+    case LteRrcEventRecord::UE_RA_RESPONSE_TIMEOUT:
+        out << "contention " << +r.arg[0] << ", preamble Tx counter " << +r.arg[1]
+            << ", max preamble Tx limit " << +r.arg[2];
+        break;
+    case LteRrcEventRecord::ENB_RRC_TIMEOUT:
+        out << g_timeoutName[std::min<uint8_t>(r.arg[0], LteRrcEventRecord::OTHER_TIMEOUT)];
+        break;
+    default:
+        break;
+    }
+}
+
+/**
+ * Decoder of the RRC event files written by LteRrcEventLog (lena-lte-rrc-event-log.h):                 LteRrcEventLog(lena-lte-rrc-event-log.h)가 기록한 RRC 이벤트 파일의
+ * one text line per event, with the time, the event, the IMSI, the cell ID, the                        디코더: 이벤트마다 시간, 이벤트, IMSI, 셀 ID, RNTI와 이벤트 인수를
+ * RNTI and the arguments of the event, the codes being turned back into the                            한 줄의 텍스트로 기록하며, 코드는 트레이스 소스의 상태 이름과 문자열로
+ * state names and strings of the trace sources. The events can be restricted to                        되돌립니다. --imsi로 한 UE의 이벤트만 남길 수 있습니다. 이벤트별
+ * one UE with --imsi. The number of events of each kind is printed at the end.                         개수는 마지막에 출력합니다.
+ *
+ * ./ns3 run "lena-lte-rrc-event-decoder --input=LteRrcEvents.bin --output=LteRrcEvents.txt"
+ */
+int
+main(int argc, char* argv[])
+{
+    std::string input = "LteRrcEvents.bin";                                                             // 입력 파일 이름
+    std::string output = "LteRrcEvents.txt";                                                            // 출력 파일 이름
+    uint64_t imsi = 0;                                                                                  // 남길 UE의 IMSI (0이면 전체)
+
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("input", "RRC event file written by LteRrcEventLog", input);                           // LteRrcEventLog가 기록한 RRC 이벤트 파일
+    cmd.AddValue("output", "Text output file", output);                                                 // 텍스트 출력 파일
+    cmd.AddValue("imsi", "IMSI of the only UE to decode, 0 for all of them", imsi);                     // 디코딩할 UE의 IMSI (0이면 전체)
+    cmd.Parse(argc, argv);
+
+    std::ifstream in(input, std::ios::in | std::ios::binary);
+    NS_ABORT_MSG_IF(!in.is_open(), "Can't open file " << input);
+    LteRrcEventFileHeader header;
+    in.read(reinterpret_cast<char*>(&header), sizeof(header));
+    NS_ABORT_MSG_IF(!in ||
+                        std::memcmp(header.magic, LTE_RRC_EVENT_MAGIC, sizeof(header.magic)) != 0,
+                    input << " is not an RRC event file");
+    NS_ABORT_MSG_IF(header.version != 1 || header.recordSize != sizeof(LteRrcEventRecord),
+                    input << " has an unsupported version or was written on another platform");
+
+    std::ofstream out(output);
+    NS_ABORT_MSG_IF(!out.is_open(), "Can't open file " << output);
+    out << "% time\tevent\tIMSI\tcellId\tRNTI\targuments" << std::endl;
+
+    std::vector<uint64_t> counts(LteRrcEventRecord::NUM_EVENTS, 0);
+    std::vector<LteRrcEventRecord> records(65536);
+    while (in)
+    {
+        in.read(reinterpret_cast<char*>(records.data()),
+                records.size() * sizeof(LteRrcEventRecord));
+        std::size_t n = in.gcount() / sizeof(LteRrcEventRecord);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            const LteRrcEventRecord& r = records[i];
+            NS_ABORT_MSG_IF(r.event >= LteRrcEventRecord::NUM_EVENTS,
+                            "unknown event " << +r.event << " in " << input);
+            if (imsi != 0 && r.imsi != imsi)
+            {
+                continue;
+            }
+            ++counts[r.event];
+            out << r.time / 1.0e9 << "\t" << g_eventName[r.event] << "\t" << r.imsi << "\t"
+                << r.cellId << "\t" << r.rnti << "\t";
+            WriteArguments(out, r);
+            out << "\n";
+        }
+    }
+
+    for (uint8_t event = 0; event < LteRrcEventRecord::NUM_EVENTS; ++event)
+    {
+        if (counts[event] > 0)
+        {
+            std::cout << g_eventName[event] << ": " << counts[event] << std::endl;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,397 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef LENA_LTE_RRC_EVENT_LOG_H
+#define LENA_LTE_RRC_EVENT_LOG_H
+
+#include "lena-binary-record-writer.h"
+#include "lena-lte-trace-connector.h"
+
+#include <ns3/abort.h>
+#include <ns3/callback.h>
+#include <ns3/lte-ue-rrc.h>
+#include <ns3/nstime.h>
+#include <ns3/simulator.h>
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+namespace ns3
+{
+
+/// Magic string at the beginning of a binary RRC event file                                            이진 RRC 이벤트 파일의 시작에 있는 매직 문자열
+static const char LTE_RRC_EVENT_MAGIC[8] = {'L', 'T', 'E', 'R', 'R', 'C', 'E', 'V'};
+
+/// Header of a binary RRC event file                                                                   이진 RRC 이벤트 파일의 헤더
+struct LteRrcEventFileHeader
+{
+    char magic[8];       ///< LTE_RRC_EVENT_MAGIC
+    uint32_t version;    ///< format version
+    uint32_t recordSize; ///< sizeof(LteRrcEventRecord)
+};
+
+/// Record of a binary RRC event file, one per RRC (or RA) event of a UE or an eNB                      UE 또는 eNB의 RRC(또는 RA) 이벤트마다 하나씩 기록되는 레코드
+struct LteRrcEventRecord
+{
+    /// Event, i.e., the trace source it comes from                                                     이벤트 (해당하는 트레이스 소스)
+    enum Event : uint8_t
+    {
+        UE_STATE_TRANSITION = 0,    ///< LteUeRrc StateTransition, arg = {old, new state}
+        UE_CONNECTION_ESTABLISHED,  ///< LteUeRrc ConnectionEstablished
+        UE_HANDOVER_START,          ///< LteUeRrc HandoverStart, value = target cell ID
+        UE_HANDOVER_END_OK,         ///< LteUeRrc HandoverEndOk
+        UE_PHY_SYNC_DETECTION,      ///< LteUeRrc PhySyncDetection, arg = {SyncType, count}
+        UE_RADIO_LINK_FAILURE,      ///< LteUeRrc RadioLinkFailure
+        UE_RANDOM_ACCESS_ERROR,     ///< LteUeRrc RandomAccessError
+        UE_CONNECTION_TIMEOUT,      ///< LteUeRrc ConnectionTimeout, arg = {T300 expirations}
+        UE_RA_RESPONSE_TIMEOUT,     ///< LteUeMac RaResponseTimeout, arg = {contention, tx, max}
+        ENB_CONNECTION_ESTABLISHED, ///< LteEnbRrc ConnectionEstablished
+        ENB_HANDOVER_START,         ///< LteEnbRrc HandoverStart, value = target cell ID
+        ENB_HANDOVER_END_OK,        ///< LteEnbRrc HandoverEndOk
+        ENB_CONNECTION_RELEASE,     ///< LteEnbRrc NotifyConnectionRelease
+        ENB_RRC_TIMEOUT,            ///< LteEnbRrc RrcTimeout, arg = {TimeoutCause}
+        NUM_EVENTS                  ///< number of events
+    };
+
+    /// Type of a UE_PHY_SYNC_DETECTION                                                                 UE_PHY_SYNC_DETECTION의 유형
+    enum SyncType : uint8_t
+    {
+        OUT_OF_SYNC = 0, ///< "Notify out of sync"
+        IN_SYNC,         ///< "Notify in sync"
+        OTHER_SYNC       ///< any other string
+    };
+
+    /// Cause of an ENB_RRC_TIMEOUT                                                                     ENB_RRC_TIMEOUT의 원인
+    enum TimeoutCause : uint8_t
+    {
+        CONNECTION_REQUEST_TIMEOUT = 0, ///< "ConnectionRequestTimeout"
+        CONNECTION_SETUP_TIMEOUT,       ///< "ConnectionSetupTimeout"
+        CONNECTION_REJECTED_TIMEOUT,    ///< "ConnectionRejectedTimeout"
+        HANDOVER_JOINING_TIMEOUT,       ///< "HandoverJoiningTimeout"
+        HANDOVER_LEAVING_TIMEOUT,       ///< "HandoverLeavingTimeout"
+        OTHER_TIMEOUT                   ///< any other string
+    };
+
+    int64_t time;        ///< simulation time [ns]
+    uint64_t imsi;       ///< IMSI
+    uint32_t value;      ///< target cell ID of the handovers
+    uint16_t cellId;     ///< cell ID, 0 for UE_RA_RESPONSE_TIMEOUT
+    uint16_t rnti;       ///< RNTI, 0 for UE_RA_RESPONSE_TIMEOUT
+    uint8_t event;       ///< LteRrcEventRecord::Event
+    uint8_t arg[3];      ///< small arguments of the event
+    uint8_t reserved[4]; ///< padding, always 0
+};
+
+static_assert(sizeof(LteRrcEventRecord) == 32, "unexpected LteRrcEventRecord layout");
+
+/**
+ * Structured log of the RRC events of the UEs and eNBs.                                                UE와 eNB의 RRC 이벤트에 대한 구조화된 로그
+ *
+ * Printing every state transition, sync indication or RLF to std::cout formats                         모든 상태 전이, 동기 표시, RLF를 std::cout으로 출력하면 이벤트마다
+ * a string per event on the simulation thread, which bounds RLF campaigns with                         시뮬레이션 스레드에서 문자열을 서식화하므로, 수천 개의 UE를 가진 RLF
+ * thousands of UEs. Here each event becomes a fixed-size LteRrcEventRecord of                          실험이 출력에 묶입니다. 여기서는 각 이벤트가 시간, IMSI, 셀 ID, RNTI,
+ * time, IMSI, cell ID, RNTI, event code and arguments, the strings of the                              이벤트 코드와 인수로 이루어진 고정 크기 LteRrcEventRecord가 되고
+ * traces being mapped to small codes, appended to the preallocated buffers of a                        트레이스의 문자열은 작은 코드로 변환되며, 레코드는 BinaryRecordWriter의
+ * BinaryRecordWriter and written to the file by its thread.                                            미리 할당된 버퍼에 추가되어 그 스레드가 파일에 기록합니다.
+ * lena-lte-rrc-event-decoder prints the file as text.                                                  lena-lte-rrc-event-decoder가 파일을 텍스트로 출력합니다.
+ *
+ * Enable() is to be called once the devices are installed, and the object must                         Enable()은 장치를 설치한 뒤 호출해야 하며, 이 객체는 Simulator::Run()보다
+ * outlive Simulator::Run(); Close() (or the destructor) writes the pending                             오래 살아 있어야 합니다. 남은 레코드는 Close() (또는 소멸자)가
+ * records.                                                                                             기록합니다.
+ */
+class LteRrcEventLog
+{
+  public:
+    LteRrcEventLog() = default;
+
+    ~LteRrcEventLog()
+    {
+        Close();
+    }
+
+    LteRrcEventLog(const LteRrcEventLog&) = delete;
+    LteRrcEventLog& operator=(const LteRrcEventLog&) = delete;
+
+    /**
+     * \param fileName the output file name, "LteRrcEvents.bin" by default                              출력 파일 이름 (기본값 "LteRrcEvents.bin")
+     */
+    void SetOutputFilename(std::string fileName)
+    {
+        NS_ABORT_MSG_IF(m_writer.IsOpen(), "the output file is already open");
+        m_fileName = fileName;
+    }
+
+    /**
+     * \param bufferRecords the number of records of each of the two buffers                           두 버퍼 각각의 레코드 수
+     */
+    void SetBufferRecords(std::size_t bufferRecords)
+    {
+        NS_ABORT_MSG_IF(m_writer.IsOpen(), "the output file is already open");
+        m_bufferRecords = bufferRecords;
+    }
+
+    /// Open the output file and connect the RRC and RA traces of all the devices                       출력 파일을 열고 모든 장치의 RRC 및 RA 트레이스를 연결합니다.
+    void Enable()
+    {
+        NS_ABORT_MSG_IF(m_writer.IsOpen(), "RRC event log already enabled");
+        LteRrcEventFileHeader header;
+        std::memset(&header, 0, sizeof(header));
+        std::memcpy(header.magic, LTE_RRC_EVENT_MAGIC, sizeof(header.magic));
+        header.version = 1;
+        header.recordSize = sizeof(LteRrcEventRecord);
+        m_writer.Open(m_fileName, header, m_bufferRecords);
+
+        LteTraceConnector traces;
+        auto event = [this](LteRrcEventRecord::Event e) {
+            return MakeBoundCallback(&LteRrcEventLog::Event, this, e);
+        };
+        auto handoverStart = [this](LteRrcEventRecord::Event e) {
+            return MakeBoundCallback(&LteRrcEventLog::HandoverStart, this, e);
+        };
+        traces.ConnectUeRrcWithoutContext(
+            "StateTransition", MakeBoundCallback(&LteRrcEventLog::StateTransition, this));
+        traces.ConnectUeRrcWithoutContext("ConnectionEstablished",
+                                          event(LteRrcEventRecord::UE_CONNECTION_ESTABLISHED));
+        traces.ConnectUeRrcWithoutContext("HandoverStart",
+                                          handoverStart(LteRrcEventRecord::UE_HANDOVER_START));
+        traces.ConnectUeRrcWithoutContext("HandoverEndOk",
+                                          event(LteRrcEventRecord::UE_HANDOVER_END_OK));
+        traces.ConnectUeRrcWithoutContext(
+            "PhySyncDetection", MakeBoundCallback(&LteRrcEventLog::PhySyncDetection, this));
+        traces.ConnectUeRrcWithoutContext("RadioLinkFailure",
+                                          event(LteRrcEventRecord::UE_RADIO_LINK_FAILURE));
+        traces.ConnectUeRrcWithoutContext("RandomAccessError",
+                                          event(LteRrcEventRecord::UE_RANDOM_ACCESS_ERROR));
+        traces.ConnectUeRrcWithoutContext(
+            "ConnectionTimeout", MakeBoundCallback(&LteRrcEventLog::ConnectionTimeout, this));
+        traces.ConnectUeMacWithoutContext(
+            "RaResponseTimeout", MakeBoundCallback(&LteRrcEventLog::RaResponseTimeout, this));
+        traces.ConnectEnbRrcWithoutContext("ConnectionEstablished",
+                                           event(LteRrcEventRecord::ENB_CONNECTION_ESTABLISHED));
+        traces.ConnectEnbRrcWithoutContext("HandoverStart",
+                                           handoverStart(LteRrcEventRecord::ENB_HANDOVER_START));
+        traces.ConnectEnbRrcWithoutContext("HandoverEndOk",
+                                           event(LteRrcEventRecord::ENB_HANDOVER_END_OK));
+        traces.ConnectEnbRrcWithoutContext("NotifyConnectionRelease",
+                                           event(LteRrcEventRecord::ENB_CONNECTION_RELEASE));
+        traces.ConnectEnbRrcWithoutContext("RrcTimeout",
+                                           MakeBoundCallback(&LteRrcEventLog::RrcTimeout, this));
+    }
+
+    /// Write the pending records and close the file                                                    남은 레코드를 기록하고 파일을 닫습니다.
+    void Close()
+    {
+        m_writer.Close();
+    }
+
+  private:
+    /**
+     * \param event the event                                                                           이벤트
+     * \param imsi the IMSI                                                                             IMSI
+     * \param cellId the cell ID                                                                        셀 ID
+     * \param rnti the RNTI                                                                             RNTI
+     * \return a zeroed record of the event, stamped with the current time                              현재 시간이 기록된, 0으로 초기화된 이벤트 레코드
+     */
+    static LteRrcEventRecord NewRecord(LteRrcEventRecord::Event event,
+                                       uint64_t imsi,
+                                       uint16_t cellId,
+                                       uint16_t rnti)
+    {
+        LteRrcEventRecord record;
+        std::memset(&record, 0, sizeof(record));
+        record.time = Simulator::Now().GetNanoSeconds();
+        record.imsi = imsi;
+        record.cellId = cellId;
+        record.rnti = rnti;
+        record.event = event;
+        return record;
+    }
+
+    /**
+     * Sink of the (imsi, cellId, rnti) traces.                                                         (imsi, cellId, rnti) 트레이스의 싱크
+     *
+     * \param log the LteRrcEventLog                                                                    LteRrcEventLog 객체
+     * \param event the event                                                                           이벤트
+     * \param imsi the IMSI                                                                             IMSI
+     * \param cellId the cell ID                                                                        셀 ID
+     * \param rnti the RNTI                                                                             RNTI
+     */
+    static void Event(LteRrcEventLog* log,
+                      LteRrcEventRecord::Event event,
+                      uint64_t imsi,
+                      uint16_t cellId,
+                      uint16_t rnti)
+    {
+        log->m_writer.Write(NewRecord(event, imsi, cellId, rnti));
+    }
+
+    /**
+     * Sink of the StateTransition trace of LteUeRrc.                                                   LteUeRrc의 StateTransition 트레이스 싱크
+     *
+     * \param log the LteRrcEventLog                                                                    LteRrcEventLog 객체
+     * \param imsi the IMSI                                                                             IMSI
+     * \param cellId the cell ID                                                                        셀 ID
+     * \param rnti the RNTI                                                                             RNTI
+     * \param oldState the old state                                                                    이전 상태
+     * \param newState the new state                                                                    새로운 상태
+     */
+    static void StateTransition(LteRrcEventLog* log,
+                                uint64_t imsi,
+                                uint16_t cellId,
+                                uint16_t rnti,
+                                LteUeRrc::State oldState,
+                                LteUeRrc::State newState)
+    {
+        LteRrcEventRecord record =
+            NewRecord(LteRrcEventRecord::UE_STATE_TRANSITION, imsi, cellId, rnti);
+        record.arg[0] = oldState;
+        record.arg[1] = newState;
+        log->m_writer.Write(record);
+    }
+
+    /**
+     * Sink of the HandoverStart traces of LteUeRrc and LteEnbRrc.                                      LteUeRrc 및 LteEnbRrc의 HandoverStart 트레이스 싱크
+     *
+     * \param log the LteRrcEventLog                                                                    LteRrcEventLog 객체
+     * \param event the event                                                                           이벤트
+     * \param imsi the IMSI                                                                             IMSI
+     * \param cellId the cell ID                                                                        셀 ID
+     * \param rnti the RNTI                                                                             RNTI
+     * \param targetCellId the target cell ID                                                           대상 셀 ID
+     */
+    static void HandoverStart(LteRrcEventLog* log,
+                              LteRrcEventRecord::Event event,
+                              uint64_t imsi,
+                              uint16_t cellId,
+                              uint16_t rnti,
+                              uint16_t targetCellId)
+    {
+        LteRrcEventRecord record = NewRecord(event, imsi, cellId, rnti);
+        record.value = targetCellId;
+        log->m_writer.Write(record);
+    }
+
+    /**
+     * Sink of the PhySyncDetection trace of LteUeRrc.                                                  LteUeRrc의 PhySyncDetection 트레이스 싱크
+     *
+     * \param log the LteRrcEventLog                                                                    LteRrcEventLog 객체
+     * \param imsi the IMSI                                                                             IMSI
+     * \param rnti the RNTI                                                                             RNTI
+     * \param cellId the cell ID                                                                        셀 ID
+     * \param type the type of indication                                                               표시 유형
+     * \param count the number of indications                                                           표시 횟수
+     */
+    static void PhySyncDetection(LteRrcEventLog* log,
+                                 uint64_t imsi,
+                                 uint16_t rnti,
+                                 uint16_t cellId,
+                                 std::string type,
+                                 uint8_t count)
+    {
+        LteRrcEventRecord record =
+            NewRecord(LteRrcEventRecord::UE_PHY_SYNC_DETECTION, imsi, cellId, rnti);
+        record.arg[0] = type == "Notify out of sync" ? LteRrcEventRecord::OUT_OF_SYNC
+                        : type == "Notify in sync"   ? LteRrcEventRecord::IN_SYNC
+                                                     : LteRrcEventRecord::OTHER_SYNC;
+        record.arg[1] = count;
+        log->m_writer.Write(record);
+    }
+
+    /**
+     * Sink of the ConnectionTimeout trace of LteUeRrc.                                                 LteUeRrc의 ConnectionTimeout 트레이스 싱크
+     *
+     * \param log the LteRrcEventLog                                                                    LteRrcEventLog 객체
+     * \param imsi the IMSI                                                                             IMSI
+     * \param cellId the cell ID                                                                        셀 ID
+     * \param rnti the RNTI                                                                             RNTI
+     * \param connEstFailCount the number of T300 expirations                                           T300 만료 횟수
+     */
+    static void ConnectionTimeout(LteRrcEventLog* log,
+                                  uint64_t imsi,
+                                  uint16_t cellId,
+                                  uint16_t rnti,
+                                  uint8_t connEstFailCount)
+    {
+        LteRrcEventRecord record =
+            NewRecord(LteRrcEventRecord::UE_CONNECTION_TIMEOUT, imsi, cellId, rnti);
+        record.arg[0] = connEstFailCount;
+        log->m_writer.Write(record);
+    }
+
+    /**
+     * Sink of the RaResponseTimeout trace of LteUeMac.                                                 LteUeMac의 RaResponseTimeout 트레이스 싱크
+     *
+     * \param log the LteRrcEventLog                                                                    LteRrcEventLog 객체
+     * \param imsi the IMSI                                                                             IMSI
+     * \param contention the contention flag                                                            경쟁 플래그
+     * \param preambleTxCounter the preamble transmission counter                                       프리앰블 전송 카운터
+     * \param maxPreambleTxLimit the maximum number of preamble transmissions                           최대 프리앰블 전송 횟수
+     */
+    static void RaResponseTimeout(LteRrcEventLog* log,
+                                  uint64_t imsi,
+                                  bool contention,
+                                  uint8_t preambleTxCounter,
+                                  uint8_t maxPreambleTxLimit)
+    {
+        LteRrcEventRecord record = NewRecord(LteRrcEventRecord::UE_RA_RESPONSE_TIMEOUT, imsi, 0, 0);
+        record.arg[0] = contention;
+        record.arg[1] = preambleTxCounter;
+        record.arg[2] = maxPreambleTxLimit;
+        log->m_writer.Write(record);
+    }
+
+    /**
+     * Sink of the RrcTimeout trace of LteEnbRrc.                                                       LteEnbRrc의 RrcTimeout 트레이스 싱크
+     *
+     * \param log the LteRrcEventLog                                                                    LteRrcEventLog 객체
+     * \param imsi the IMSI                                                                             IMSI
+     * \param rnti the RNTI                                                                             RNTI
+     * \param cellId the cell ID                                                                        셀 ID
+     * \param cause the cause of the timeout                                                            타임아웃 원인
+     */
+    static void RrcTimeout(LteRrcEventLog* log,
+                           uint64_t imsi,
+                           uint16_t rnti,
+                           uint16_t cellId,
+                           std::string cause)
+    {
+        static const char* const causes[] = {"ConnectionRequestTimeout",
+                                             "ConnectionSetupTimeout",
+                                             "ConnectionRejectedTimeout",
+                                             "HandoverJoiningTimeout",
+                                             "HandoverLeavingTimeout"};
+        LteRrcEventRecord record =
+            NewRecord(LteRrcEventRecord::ENB_RRC_TIMEOUT, imsi, cellId, rnti);
+        record.arg[0] = LteRrcEventRecord::OTHER_TIMEOUT;
+        for (uint8_t i = 0; i < LteRrcEventRecord::OTHER_TIMEOUT; ++i)
+        {
+            if (cause == causes[i])
+            {
+                record.arg[0] = i;
+                break;
+            }
+        }
+        log->m_writer.Write(record);
+    }
+
+    BinaryRecordWriter<LteRrcEventRecord> m_writer; ///< record writer
+    std::string m_fileName{"LteRrcEvents.bin"};     ///< output file name
+    std::size_t m_bufferRecords{65536};             ///< records per buffer
+};
+
+} // namespace ns3
+
+#endif // LENA_LTE_RRC_EVENT_LOG_H
@@ -0,0 +1,171 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef LENA_LTE_TRACE_CONNECTOR_H
+#define LENA_LTE_TRACE_CONNECTOR_H
+
+#include <ns3/abort.h>
+#include <ns3/callback.h>
+#include <ns3/component-carrier-ue.h>
+#include <ns3/lte-enb-net-device.h>
+#include <ns3/lte-enb-rrc.h>
+#include <ns3/lte-ue-mac.h>
+#include <ns3/lte-ue-net-device.h>
+#include <ns3/lte-ue-rrc.h>
+#include <ns3/node-list.h>
+#include <ns3/node.h>
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * Connect the RRC and MAC traces of all the LTE devices without resolving                              Config 경로를 해석하지 않고 모든 LTE 장치의 RRC 및 MAC 트레이스를
+ * Config paths.                                                                                        연결합니다.
+ *
+ * Config::Connect("/NodeList/ * /DeviceList/ * /LteUeRrc/StateTransition", ...)                        Config::Connect("/NodeList/ * /DeviceList/ * /LteUeRrc/StateTransition", ...)는
+ * splits the path and, for every call, walks every node and every device and                           경로를 나누고, 호출할 때마다 모든 노드와 장치를 순회하며 각 장치의
+ * looks up the attributes of each one by name. Here the nodes are walked once,                         속성을 이름으로 찾습니다. 여기서는 노드를 생성 시 한 번만 순회하여
+ * at construction, and the UE and eNB devices are kept with the path of their                          UE와 eNB 장치를 각 장치의 경로와 함께 보관하므로, 각 연결은 일치하는
+ * device, so each connection is a direct TraceConnect() on the matching                                객체에 대한 직접적인 TraceConnect()이고 전체 연결 비용은 장치 수에
+ * objects and bulk connects cost time linear in the number of devices. The                             비례합니다. 컨텍스트가 있는 연결의 컨텍스트는 Config::Connect()와 같은
+ * context of the connections with context is the same path Config::Connect()                           경로이므로 컨텍스트를 해석하는 싱크도 그대로 동작합니다.
+ * gives, so sinks parsing it keep working.
+ *
+ * As for Config::Connect(), only the devices installed before the connector is                         Config::Connect()와 마찬가지로 커넥터를 만들기 전에 설치된 장치만
+ * built are connected.                                                                                 연결됩니다.
+ */
+class LteTraceConnector
+{
+  public:
+    LteTraceConnector()
+    {
+        for (auto it = NodeList::Begin(); it != NodeList::End(); ++it)
+        {
+            for (uint32_t j = 0; j < (*it)->GetNDevices(); ++j)
+            {
+                Ptr<NetDevice> dev = (*it)->GetDevice(j);
+                std::ostringstream path;
+                path << "/NodeList/" << (*it)->GetId() << "/DeviceList/" << j;
+                if (Ptr<LteUeNetDevice> ueDev = dev->GetObject<LteUeNetDevice>())
+                {
+                    m_ueDevs.push_back({path.str(), ueDev});
+                }
+                else if (Ptr<LteEnbNetDevice> enbDev = dev->GetObject<LteEnbNetDevice>())
+                {
+                    m_enbDevs.push_back({path.str(), enbDev});
+                }
+            }
+        }
+    }
+
+    /**
+     * Same as Config::Connect("/NodeList/ * /DeviceList/ * /LteUeRrc/<name>", cb).                     Config::Connect("/NodeList/ * /DeviceList/ * /LteUeRrc/<name>", cb)와 같습니다.
+     *
+     * \param name the name of the trace source                                                         트레이스 소스 이름
+     * \param cb the sink, with a context                                                               컨텍스트를 받는 싱크
+     */
+    void ConnectUeRrc(const std::string& name, const CallbackBase& cb)
+    {
+        for (const auto& ue : m_ueDevs)
+        {
+            bool ok = ue.dev->GetRrc()->TraceConnect(name, ue.path + "/LteUeRrc/" + name, cb);
+            NS_ABORT_MSG_IF(!ok, "LteUeRrc has no trace source " << name);
+        }
+    }
+
+    /**
+     * Same as Config::ConnectWithoutContext("/NodeList/ * /DeviceList/ * /LteUeRrc/<name>", cb).       Config::ConnectWithoutContext("/NodeList/ * /DeviceList/ * /LteUeRrc/<name>", cb)와 같습니다.
+     *
+     * \param name the name of the trace source                                                         트레이스 소스 이름
+     * \param cb the sink                                                                               싱크
+     */
+    void ConnectUeRrcWithoutContext(const std::string& name, const CallbackBase& cb)
+    {
+        for (const auto& ue : m_ueDevs)
+        {
+            bool ok = ue.dev->GetRrc()->TraceConnectWithoutContext(name, cb);
+            NS_ABORT_MSG_IF(!ok, "LteUeRrc has no trace source " << name);
+        }
+    }
+
+    /**
+     * Same as Config::Connect("/NodeList/ * /DeviceList/ * /LteEnbRrc/<name>", cb).                    Config::Connect("/NodeList/ * /DeviceList/ * /LteEnbRrc/<name>", cb)와 같습니다.
+     *
+     * \param name the name of the trace source                                                         트레이스 소스 이름
+     * \param cb the sink, with a context                                                               컨텍스트를 받는 싱크
+     */
+    void ConnectEnbRrc(const std::string& name, const CallbackBase& cb)
+    {
+        for (const auto& enb : m_enbDevs)
+        {
+            bool ok = enb.dev->GetRrc()->TraceConnect(name, enb.path + "/LteEnbRrc/" + name, cb);
+            NS_ABORT_MSG_IF(!ok, "LteEnbRrc has no trace source " << name);
+        }
+    }
+
+    /**
+     * Same as Config::ConnectWithoutContext("/NodeList/ * /DeviceList/ * /LteEnbRrc/<name>", cb).      Config::ConnectWithoutContext("/NodeList/ * /DeviceList/ * /LteEnbRrc/<name>", cb)와 같습니다.
+     *
+     * \param name the name of the trace source                                                         트레이스 소스 이름
+     * \param cb the sink                                                                               싱크
+     */
+    void ConnectEnbRrcWithoutContext(const std::string& name, const CallbackBase& cb)
+    {
+        for (const auto& enb : m_enbDevs)
+        {
+            bool ok = enb.dev->GetRrc()->TraceConnectWithoutContext(name, cb);
+            NS_ABORT_MSG_IF(!ok, "LteEnbRrc has no trace source " << name);
+        }
+    }
+
+    /**
+     * Same as Config::ConnectWithoutContext("/NodeList/ * /DeviceList/ * /$ns3::LteUeNetDevice/        Config::ConnectWithoutContext("/NodeList/ * /DeviceList/ * /$ns3::LteUeNetDevice/
+     * ComponentCarrierMapUe/ * /LteUeMac/<name>", cb).                                                 ComponentCarrierMapUe/ * /LteUeMac/<name>", cb)와 같습니다.
+     *
+     * \param name the name of the trace source                                                         트레이스 소스 이름
+     * \param cb the sink                                                                               싱크
+     */
+    void ConnectUeMacWithoutContext(const std::string& name, const CallbackBase& cb)
+    {
+        for (const auto& ue : m_ueDevs)
+        {
+            for (const auto& cc : ue.dev->GetCcMap())
+            {
+                bool ok = cc.second->GetMac()->TraceConnectWithoutContext(name, cb);
+                NS_ABORT_MSG_IF(!ok, "LteUeMac has no trace source " << name);
+            }
+        }
+    }
+
+  private:
+    /// A device and its Config path                                                                    장치와 그 Config 경로
+    template <class Device>
+    struct PathDevice
+    {
+        std::string path; ///< "/NodeList/<i>/DeviceList/<j>"
+        Ptr<Device> dev;  ///< the device
+    };
+
+    std::vector<PathDevice<LteUeNetDevice>> m_ueDevs;   ///< UE devices
+    std::vector<PathDevice<LteEnbNetDevice>> m_enbDevs; ///< eNB devices
+};
+
+} // namespace ns3
+
+#endif // LENA_LTE_TRACE_CONNECTOR_H
@@ -0,0 +1,339 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "lena-lte-binary-traces.h"
+
+#include "ns3/core-module.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE("LenaLteTraceConverter");
+
+/**
+ * Running minimum, maximum, mean and standard deviation, computed as                                   MinMaxAvgTotalCalculator와 같은 방식으로 계산되는
+ * MinMaxAvgTotalCalculator does.                                                                       최소, 최대, 평균, 표준 편차
+ */
+struct RunningStats
+{
+    uint32_t count{0}; ///< number of samples
+    double min{0};     ///< minimum
+    double max{0};     ///< maximum
+    double mean{0};    ///< mean
+    double s{0};       ///< sum of the squared deviations from the mean
+
+    /**
+     * \param value the new sample                                                                      새 샘플
+     */
+    void Update(double value)
+    {
+        ++count;
+        if (count == 1)
+        {
+            min = max = mean = value;
+            s = 0;
+            return;
+        }
+        min = std::min(min, value);
+        max = std::max(max, value);
+        double previousMean = mean;
+        mean = previousMean + (value - previousMean) / count;
+        s = s + (value - previousMean) * (value - mean);
+    }
+
+    /**
+     * \return the sample standard deviation                                                            표본 표준 편차
+     */
+    double GetStddev() const
+    {
+        return count > 1 ? std::sqrt(s / (count - 1)) : 0.0;
+    }
+};
+
+/// Statistics of a radio bearer over an epoch, as gathered by RadioBearerStatsCalculator               RadioBearerStatsCalculator가 수집하는 에포크 동안의 무선 베어러 통계
+struct BearerEpochStats
+{
+    uint16_t cellId{0};    ///< cell ID
+    uint16_t rnti{0};      ///< RNTI
+    bool enbSide{false};   ///< cellId and rnti come from the eNB
+    bool hasTx{false};     ///< at least one PDU sent
+    uint32_t txPackets{0}; ///< PDUs sent
+    uint64_t txBytes{0};   ///< bytes sent
+    bool hasRx{false};     ///< at least one PDU received
+    uint32_t rxPackets{0}; ///< PDUs received
+    uint64_t rxBytes{0};   ///< bytes received
+    RunningStats delay;    ///< delay of the received PDUs [ns]
+    RunningStats pduSize;  ///< size of the received PDUs
+};
+
+/**
+ * Rebuilds the DL and UL files of a RadioBearerStatsCalculator (RLC or PDCP)                           RLC 또는 PDCP 레코드로부터 RadioBearerStatsCalculator의 DL 및 UL 파일을
+ * from the records, one epoch at a time.                                                               에포크 단위로 다시 만듭니다.
+ */
+class RadioBearerStatsWriter
+{
+  public:
+    /**
+     * \param dlFileName the DL output file name                                                        DL 출력 파일 이름
+     * \param ulFileName the UL output file name                                                        UL 출력 파일 이름
+     * \param startTime the start time of the statistics [ns]                                           통계 시작 시간 [ns]
+     * \param epochDuration the epoch duration [ns]                                                     에포크 길이 [ns]
+     */
+    RadioBearerStatsWriter(std::string dlFileName,
+                           std::string ulFileName,
+                           int64_t startTime,
+                           int64_t epochDuration)
+        : m_dlFileName(dlFileName),
+          m_ulFileName(ulFileName),
+          m_startTime(startTime),
+          m_epochDuration(epochDuration)
+    {
+        NS_ABORT_MSG_IF(epochDuration <= 0, "invalid epoch duration in the trace file");
+    }
+
+    /**
+     * Account for a PDU record.                                                                        PDU 레코드를 반영합니다.
+     *
+     * \param record the record                                                                         레코드
+     * \param downlink true for a DL record                                                             DL 레코드이면 참
+     * \param tx true for a TxPDU record                                                                TxPDU 레코드이면 참
+     */
+    void Add(const LteTraceRecord& record, bool downlink, bool tx)
+    {
+        if (record.time < m_startTime)
+        {
+            return;
+        }
+        int64_t epoch = (record.time - m_startTime) / m_epochDuration;
+        if (epoch != m_epoch)
+        {
+            Flush();
+            m_epoch = epoch;
+        }
+        BearerEpochStats& stats = (downlink ? m_dl : m_ul)[{record.imsi, record.lcid}];
+        // the cell ID and RNTI are taken at the eNB, i.e., on DL TX and UL RX                          셀 ID와 RNTI는 eNB에서, 즉 DL TX와 UL RX에서 가져옵니다.
+        bool enbSide = (downlink == tx);
+        if (enbSide || !stats.enbSide)
+        {
+            stats.cellId = record.cellId;
+            stats.rnti = record.rnti;
+            stats.enbSide = enbSide;
+        }
+        if (tx)
+        {
+            stats.hasTx = true;
+            ++stats.txPackets;
+            stats.txBytes += record.size;
+        }
+        else
+        {
+            stats.hasRx = true;
+            ++stats.rxPackets;
+            stats.rxBytes += record.size;
+            stats.delay.Update(record.delay);
+            stats.pduSize.Update(record.size);
+        }
+    }
+
+    /// Write the statistics of the current epoch                                                       현재 에포크의 통계를 기록합니다.
+    void Flush()
+    {
+        if (m_dl.empty() && m_ul.empty())
+        {
+            return;
+        }
+        if (!m_dlFile.is_open())
+        {
+            Open(m_dlFile, m_dlFileName);
+            Open(m_ulFile, m_ulFileName);
+        }
+        Write(m_ulFile, m_ul);
+        Write(m_dlFile, m_dl);
+        m_dl.clear();
+        m_ul.clear();
+    }
+
+  private:
+    /// IMSI and LCID of a bearer                                                                       베어러의 IMSI와 LCID
+    using Key = std::pair<uint64_t, uint8_t>;
+
+    /**
+     * \param file the file to open                                                                     열 파일
+     * \param fileName the file name                                                                    파일 이름
+     */
+    static void Open(std::ofstream& file, const std::string& fileName)
+    {
+        file.open(fileName);
+        NS_ABORT_MSG_IF(!file.is_open(), "Can't open file " << fileName);
+        file << "% start\tend\tCellId\tIMSI\tRNTI\tLCID\tnTxPDUs\tTxBytes\tnRxPDUs\tRxBytes\t"
+             << "delay\tstdDev\tmin\tmax\tPduSize\tstdDev\tmin\tmax" << std::endl;
+    }
+
+    /**
+     * Write the rows of an epoch, the bearers with sent PDUs first, as                                 RadioBearerStatsCalculator와 같이 PDU를 보낸 베어러부터
+     * RadioBearerStatsCalculator does.                                                                 에포크의 행을 기록합니다.
+     *
+     * \param file the output file                                                                      출력 파일
+     * \param stats the statistics of the epoch                                                         에포크의 통계
+     */
+    void Write(std::ofstream& file, const std::map<Key, BearerEpochStats>& stats)
+    {
+        int64_t start = m_startTime + m_epoch * m_epochDuration;
+        for (bool txPass : {true, false})
+        {
+            for (const auto& [key, s] : stats)
+            {
+                if (s.hasTx != txPass)
+                {
+                    continue;
+                }
+                file << start / 1.0e9 << "\t" << (start + m_epochDuration) / 1.0e9 << "\t"
+                     << s.cellId << "\t" << key.first << "\t" << s.rnti << "\t"
+                     << (uint32_t)key.second << "\t" << s.txPackets << "\t" << s.txBytes << "\t"
+                     << s.rxPackets << "\t" << s.rxBytes << "\t";
+                file << s.delay.mean * 1e-9 << "\t" << s.delay.GetStddev() * 1e-9 << "\t"
+                     << s.delay.min * 1e-9 << "\t" << s.delay.max * 1e-9 << "\t";
+                file << s.pduSize.mean << "\t" << s.pduSize.GetStddev() << "\t" << s.pduSize.min
+                     << "\t" << s.pduSize.max << "\t" << std::endl;
+            }
+        }
+    }
+
+    std::string m_dlFileName;             ///< DL output file name
+    std::string m_ulFileName;             ///< UL output file name
+    std::ofstream m_dlFile;               ///< DL output file
+    std::ofstream m_ulFile;               ///< UL output file
+    int64_t m_startTime;                  ///< start time of the statistics [ns]
+    int64_t m_epochDuration;              ///< epoch duration [ns]
+    int64_t m_epoch{-1};                  ///< current epoch
+    std::map<Key, BearerEpochStats> m_dl; ///< DL statistics of the current epoch
+    std::map<Key, BearerEpochStats> m_ul; ///< UL statistics of the current epoch
+};
+
+/**
+ * Converter of the binary traces written by LteBinaryTraces (lena-lte-binary-traces.h)                 LteBinaryTraces(lena-lte-binary-traces.h)가 기록한 이진 트레이스를
+ * to the text files written by LteHelper::EnableTraces(): DlMacStats.txt,                              LteHelper::EnableTraces()가 기록하는 텍스트 파일로 변환합니다:
+ * UlMacStats.txt, DlRlcStats.txt, UlRlcStats.txt, DlPdcpStats.txt and                                  DlMacStats.txt, UlMacStats.txt, DlRlcStats.txt, UlRlcStats.txt,
+ * UlPdcpStats.txt. Only the files of the enabled traces are written.                                   DlPdcpStats.txt, UlPdcpStats.txt. 활성화된 트레이스의 파일만 기록됩니다.
+ *
+ * ./ns3 run "lena-lte-trace-converter --input=LteTraces.bin"
+ */
+int
+main(int argc, char* argv[])
+{
+    std::string input = "LteTraces.bin";                                                            // 입력 파일 이름
+
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("input", "Binary trace file written by LteBinaryTraces", input);                   // LteBinaryTraces가 기록한 이진 트레이스 파일
+    cmd.Parse(argc, argv);
+
+    std::ifstream in(input, std::ios::in | std::ios::binary);
+    NS_ABORT_MSG_IF(!in.is_open(), "Can't open file " << input);
+    LteTraceFileHeader header;
+    in.read(reinterpret_cast<char*>(&header), sizeof(header));
+    NS_ABORT_MSG_IF(!in || std::memcmp(header.magic, LTE_TRACE_MAGIC, sizeof(header.magic)) != 0,
+                    input << " is not a binary LTE trace file");
+    NS_ABORT_MSG_IF(header.version != 1 || header.recordSize != sizeof(LteTraceRecord),
+                    input << " has an unsupported version or was written on another platform");
+
+    std::ofstream dlMac;
+    std::ofstream ulMac;
+    RadioBearerStatsWriter rlc("DlRlcStats.txt",
+                               "UlRlcStats.txt",
+                               header.startTime,
+                               header.epochDuration);
+    RadioBearerStatsWriter pdcp("DlPdcpStats.txt",
+                                "UlPdcpStats.txt",
+                                header.startTime,
+                                header.epochDuration);
+
+    uint64_t nRecords = 0;
+    std::vector<LteTraceRecord> records(65536);
+    while (in)
+    {
+        in.read(reinterpret_cast<char*>(records.data()), records.size() * sizeof(LteTraceRecord));
+        std::size_t n = in.gcount() / sizeof(LteTraceRecord);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            const LteTraceRecord& r = records[i];
+            switch (r.type)
+            {
+            case LteTraceRecord::DL_MAC:
+                if (!dlMac.is_open())
+                {
+                    dlMac.open("DlMacStats.txt");
+                    dlMac << "% time\tcellId\tIMSI\tframe\tsframe\tRNTI\tmcsTb1\tsizeTb1\tmcsTb2\t"
+                          << "sizeTb2\tccId" << std::endl;
+                }
+                dlMac << r.time / 1.0e9 << "\t" << r.cellId << "\t" << r.imsi << "\t" << r.frameNo
+                      << "\t" << (uint32_t)r.subframeNo << "\t" << r.rnti << "\t"
+                      << (uint32_t)r.mcs << "\t" << r.size << "\t" << (uint32_t)r.mcs2 << "\t"
+                      << r.size2 << "\t" << (uint32_t)r.lcid << "\n";
+                break;
+            case LteTraceRecord::UL_MAC:
+                if (!ulMac.is_open())
+                {
+                    ulMac.open("UlMacStats.txt");
+                    ulMac << "% time\tcellId\tIMSI\tframe\tsframe\tRNTI\tmcs\tsize\tccId"
+                          << std::endl;
+                }
+                ulMac << r.time / 1.0e9 << "\t" << r.cellId << "\t" << r.imsi << "\t" << r.frameNo
+                      << "\t" << (uint32_t)r.subframeNo << "\t" << r.rnti << "\t"
+                      << (uint32_t)r.mcs << "\t" << r.size << "\t" << (uint32_t)r.lcid << "\n";
+                break;
+            case LteTraceRecord::DL_RLC_TX:
+                rlc.Add(r, true, true);
+                break;
+            case LteTraceRecord::DL_RLC_RX:
+                rlc.Add(r, true, false);
+                break;
+            case LteTraceRecord::UL_RLC_TX:
+                rlc.Add(r, false, true);
+                break;
+            case LteTraceRecord::UL_RLC_RX:
+                rlc.Add(r, false, false);
+                break;
+            case LteTraceRecord::DL_PDCP_TX:
+                pdcp.Add(r, true, true);
+                break;
+            case LteTraceRecord::DL_PDCP_RX:
+                pdcp.Add(r, true, false);
+                break;
+            case LteTraceRecord::UL_PDCP_TX:
+                pdcp.Add(r, false, true);
+                break;
+            case LteTraceRecord::UL_PDCP_RX:
+                pdcp.Add(r, false, false);
+                break;
+            default:
+                NS_FATAL_ERROR("unknown record type " << (uint32_t)r.type << " in " << input);
+            }
+        }
+        nRecords += n;
+    }
+    rlc.Flush();
+    pdcp.Flush();
+
+    std::cout << "converted " << nRecords << " records from " << input << std::endl;
+    return 0;
+}
@@ -0,0 +1,509 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef LENA_MAPPED_FADING_TRACE_H
+#define LENA_MAPPED_FADING_TRACE_H
+
+#include <ns3/abort.h>
+#include <ns3/assert.h>
+#include <ns3/double.h>
+#include <ns3/mobility-model.h>
+#include <ns3/nstime.h>
+#include <ns3/object.h>
+#include <ns3/random-variable-stream.h>
+#include <ns3/simulator.h>
+#include <ns3/spectrum-propagation-loss-model.h>
+#include <ns3/spectrum-signal-parameters.h>
+#include <ns3/spectrum-value.h>
+#include <ns3/string.h>
+#include <ns3/uinteger.h>
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <system_error>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#ifndef __WIN32__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace ns3
+{
+
+/**
+ * Fading trace loaded once per process and shared read-only by all the models using it.                프로세스당 한 번 로드되어 이를 사용하는 모든 모델이 읽기 전용으로 공유하는 페이딩 트레이스
+ *
+ * The text trace (RbNum lines of SamplesNum samples in dB, the format read by                          텍스트 트레이스(SamplesNum개의 dB 샘플로 이루어진 RbNum개의 줄,
+ * TraceFadingLossModel) is converted once to a binary file in a cache directory,                       TraceFadingLossModel이 읽는 형식)는 캐시 디렉터리(기본값은 작업 디렉터리)의
+ * the working directory by default, so that the source tree is never written.                          이진 파일로 한 번 변환되므로 소스 트리에는 쓰지 않습니다. 파일 이름은
+ * The file is named after the trace and a hash of its path, and holds a header                         트레이스 이름과 그 경로의 해시로 정해지며, 헤더 뒤에 RB 순서로 double
+ * followed by the samples as doubles, RB after RB. The binary file is reconverted                      샘플이 이어집니다. 텍스트 파일이 더 새롭거나 크기가 다를 때만 다시
+ * only if the text file is newer or the dimensions differ, and is then memory-mapped:                  변환되며, 그 후 메모리 매핑됩니다. 같은 트레이스에 대한 이후 요청(다른
+ * later requests for the same trace, from other models or from later runs in the                       모델 또는 같은 프로세스의 이후 실행)은 같은 매핑을 받고, 동시에 실행되는
+ * same process, get the same mapping, and concurrent processes share its pages.                        프로세스들은 그 페이지를 공유합니다. 캐시 디렉터리에 쓰거나 파일을
+ * If the cache directory can't be written or the file can't be mapped, the text                        매핑할 수 없으면 대신 텍스트 트레이스를 메모리로 파싱합니다.
+ * trace is parsed into memory instead.
+ */
+class MappedFadingTrace
+{
+  public:
+    /**
+     * Get a trace, converting and mapping it on the first request.                                     트레이스를 가져옵니다. 첫 요청 시 변환하고 매핑합니다.
+     *
+     * \param traceFile the name of the text trace                                                      텍스트 트레이스의 파일 이름
+     * \param rbNum the number of RBs of the trace                                                      트레이스의 RB 수
+     * \param samplesNum the number of samples per RB                                                   RB당 샘플 수
+     * \param cacheDir the directory of the binary trace, the working directory if empty                이진 트레이스의 디렉터리 (비어 있으면 작업 디렉터리)
+     * \return the shared trace                                                                         공유된 트레이스
+     */
+    static std::shared_ptr<const MappedFadingTrace> Get(const std::string& traceFile,
+                                                        uint32_t rbNum,
+                                                        uint32_t samplesNum,
+                                                        const std::string& cacheDir = "")
+    {
+        static std::map<std::tuple<std::string, uint32_t, uint32_t, std::string>,
+                        std::shared_ptr<const MappedFadingTrace>>
+            traces;
+        auto key = std::make_tuple(traceFile, rbNum, samplesNum, cacheDir);
+        auto it = traces.find(key);
+        if (it == traces.end())
+        {
+            std::shared_ptr<const MappedFadingTrace> trace(
+                new MappedFadingTrace(traceFile, rbNum, samplesNum, cacheDir));
+            it = traces.emplace(key, trace).first;
+        }
+        return it->second;
+    }
+
+    ~MappedFadingTrace()
+    {
+#ifndef __WIN32__
+        if (m_map != nullptr)
+        {
+            munmap(m_map, m_mapSize);
+        }
+#endif
+    }
+
+    MappedFadingTrace(const MappedFadingTrace&) = delete;
+    MappedFadingTrace& operator=(const MappedFadingTrace&) = delete;
+
+    /**
+     * \param rb the RB index                                                                           RB 인덱스
+     * \param sample the sample index                                                                   샘플 인덱스
+     * \return the fading sample [dB]                                                                   페이딩 샘플 [dB]
+     */
+    double GetSample(uint32_t rb, uint32_t sample) const
+    {
+        NS_ASSERT(rb < m_rbNum && sample < m_samplesNum);
+        return m_samples[static_cast<std::size_t>(rb) * m_samplesNum + sample];
+    }
+
+  private:
+    /// Header of the binary trace                                                                      이진 트레이스의 헤더
+    struct FileHeader
+    {
+        char magic[8];       ///< "LTEFADE1"
+        uint32_t rbNum;      ///< number of RBs
+        uint32_t samplesNum; ///< number of samples per RB
+    };
+
+    /**
+     * \param traceFile the name of the text trace                                                      텍스트 트레이스의 파일 이름
+     * \param rbNum the number of RBs of the trace                                                      트레이스의 RB 수
+     * \param samplesNum the number of samples per RB                                                   RB당 샘플 수
+     * \param cacheDir the directory of the binary trace, the working directory if empty                이진 트레이스의 디렉터리 (비어 있으면 작업 디렉터리)
+     */
+    MappedFadingTrace(const std::string& traceFile,
+                      uint32_t rbNum,
+                      uint32_t samplesNum,
+                      const std::string& cacheDir)
+        : m_rbNum(rbNum),
+          m_samplesNum(samplesNum)
+    {
+        std::string binFile = GetBinaryFile(traceFile, cacheDir);
+        if ((IsUpToDate(traceFile, binFile) || Convert(traceFile, binFile)) && Map(binFile))
+        {
+            return;
+        }
+        Parse(traceFile, m_buffer);
+        m_samples = m_buffer.data();
+    }
+
+    /**
+     * \param traceFile the name of the text trace                                                      텍스트 트레이스의 파일 이름
+     * \param cacheDir the directory of the binary trace, the working directory if empty                이진 트레이스의 디렉터리 (비어 있으면 작업 디렉터리)
+     * \return the name of the binary trace, unique for each text trace                                 텍스트 트레이스마다 고유한 이진 트레이스의 파일 이름
+     */
+    static std::string GetBinaryFile(const std::string& traceFile, const std::string& cacheDir)
+    {
+        std::error_code ec;
+        std::filesystem::path path = std::filesystem::absolute(traceFile, ec);
+        std::ostringstream name;
+        name << std::filesystem::path(traceFile).filename().string() << "." << std::hex
+             << std::hash<std::string>()(ec ? traceFile : path.lexically_normal().string())
+             << ".bin";
+        return (std::filesystem::path(cacheDir) / name.str()).string();
+    }
+
+    /**
+     * \return the size of the binary trace [bytes]                                                     이진 트레이스의 크기 [바이트]
+     */
+    std::size_t GetFileSize() const
+    {
+        return sizeof(FileHeader) +
+               static_cast<std::size_t>(m_rbNum) * m_samplesNum * sizeof(double);
+    }
+
+    /**
+     * \param traceFile the name of the text trace                                                      텍스트 트레이스의 파일 이름
+     * \param binFile the name of the binary trace                                                      이진 트레이스의 파일 이름
+     * \return true if the binary trace exists, is not older than the text trace                        이진 트레이스가 존재하고, 텍스트 트레이스보다 오래되지 않았으며
+     *         and has the expected dimensions                                                          예상한 크기를 가지면 참
+     */
+    bool IsUpToDate(const std::string& traceFile, const std::string& binFile) const
+    {
+        std::error_code ec;
+        auto binTime = std::filesystem::last_write_time(binFile, ec);
+        if (ec || std::filesystem::file_size(binFile, ec) != GetFileSize() || ec)
+        {
+            return false;
+        }
+        auto textTime = std::filesystem::last_write_time(traceFile, ec);
+        if (!ec && textTime > binTime)
+        {
+            return false;
+        }
+        FileHeader header;
+        std::ifstream ifBin(binFile, std::ios::in | std::ios::binary);
+        ifBin.read(reinterpret_cast<char*>(&header), sizeof(header));
+        return ifBin.good() && std::memcmp(header.magic, "LTEFADE1", 8) == 0 &&
+               header.rbNum == m_rbNum && header.samplesNum == m_samplesNum;
+    }
+
+    /**
+     * Read the text trace.                                                                             텍스트 트레이스를 읽습니다.
+     *
+     * \param traceFile the name of the text trace                                                      텍스트 트레이스의 파일 이름
+     * \param samples the samples, RB after RB                                                          RB 순서의 샘플
+     */
+    void Parse(const std::string& traceFile, std::vector<double>& samples) const
+    {
+        std::ifstream ifTraceFile(traceFile, std::ifstream::in);
+        NS_ABORT_MSG_IF(!ifTraceFile.good(), "Fading trace file " << traceFile << " not found");
+        samples.resize(static_cast<std::size_t>(m_rbNum) * m_samplesNum);
+        for (auto& sample : samples)
+        {
+            ifTraceFile >> sample;
+        }
+        NS_ABORT_MSG_IF(ifTraceFile.fail(),
+                        "Fading trace file " << traceFile << " has less than " << m_rbNum
+                                             << " RBs of " << m_samplesNum << " samples");
+    }
+
+    /**
+     * Convert the text trace to the binary format.                                                     텍스트 트레이스를 이진 형식으로 변환합니다.
+     *
+     * The binary trace is written to a temporary file, then renamed, so that                           이진 트레이스는 임시 파일에 기록된 뒤 이름이 바뀌므로,
+     * processes started at the same time never map a partial file.                                     동시에 시작된 프로세스가 불완전한 파일을 매핑하지 않습니다.
+     *
+     * \param traceFile the name of the text trace                                                      텍스트 트레이스의 파일 이름
+     * \param binFile the name of the binary trace                                                      이진 트레이스의 파일 이름
+     * \return false if the binary trace could not be written                                           이진 트레이스를 기록할 수 없으면 거짓
+     */
+    bool Convert(const std::string& traceFile, const std::string& binFile) const
+    {
+        std::error_code ec;
+        std::filesystem::path dir = std::filesystem::path(binFile).parent_path();
+        if (!dir.empty())
+        {
+            std::filesystem::create_directories(dir, ec);
+        }
+        std::vector<double> samples;
+        Parse(traceFile, samples);
+        FileHeader header;
+        std::memcpy(header.magic, "LTEFADE1", 8);
+        header.rbNum = m_rbNum;
+        header.samplesNum = m_samplesNum;
+#ifndef __WIN32__
+        std::string tmpFile = binFile + "." + std::to_string(getpid());
+#else
+        std::string tmpFile = binFile + ".tmp";
+#endif
+        std::ofstream ofBin(tmpFile, std::ios::out | std::ios::binary | std::ios::trunc);
+        if (!ofBin.is_open())
+        {
+            return false;
+        }
+        ofBin.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        ofBin.write(reinterpret_cast<const char*>(samples.data()), samples.size() * sizeof(double));
+        ofBin.close();
+        if (ofBin.fail() || std::rename(tmpFile.c_str(), binFile.c_str()) != 0)
+        {
+            std::remove(tmpFile.c_str());
+            return false;
+        }
+        return true;
+    }
+
+    /**
+     * Map the binary trace.                                                                            이진 트레이스를 매핑합니다.
+     *
+     * \param binFile the name of the binary trace                                                      이진 트레이스의 파일 이름
+     * \return false if the binary trace could not be mapped                                            이진 트레이스를 매핑할 수 없으면 거짓
+     */
+    bool Map(const std::string& binFile)
+    {
+#ifndef __WIN32__
+        int fd = open(binFile.c_str(), O_RDONLY);
+        if (fd < 0)
+        {
+            return false;
+        }
+        m_mapSize = GetFileSize();
+        void* map = mmap(nullptr, m_mapSize, PROT_READ, MAP_SHARED, fd, 0);
+        close(fd);
+        if (map == MAP_FAILED)
+        {
+            return false;
+        }
+        m_map = map;
+        m_samples = reinterpret_cast<const double*>(static_cast<const char*>(map) +
+                                                    sizeof(FileHeader));
+#else
+        std::ifstream ifBin(binFile, std::ios::in | std::ios::binary);
+        ifBin.seekg(sizeof(FileHeader));
+        m_buffer.resize(static_cast<std::size_t>(m_rbNum) * m_samplesNum);
+        ifBin.read(reinterpret_cast<char*>(m_buffer.data()), m_buffer.size() * sizeof(double));
+        if (!ifBin.good())
+        {
+            return false;
+        }
+        m_samples = m_buffer.data();
+#endif
+        return true;
+    }
+
+    uint32_t m_rbNum;                 ///< number of RBs
+    uint32_t m_samplesNum;            ///< number of samples per RB
+    const double* m_samples{nullptr}; ///< samples, RB after RB
+    void* m_map{nullptr};             ///< mapping of the binary trace
+    std::size_t m_mapSize{0};         ///< size of the mapping
+    std::vector<double> m_buffer;     ///< samples, when the trace is not mapped
+};
+
+/**
+ * Fading loss model reading its trace from a shared MappedFadingTrace.                                 공유된 MappedFadingTrace에서 트레이스를 읽는 페이딩 손실 모델
+ *
+ * Drop-in replacement of TraceFadingLossModel, with the same attributes: each link                     TraceFadingLossModel을 그대로 대체하며 속성도 같습니다. 각 링크는
+ * reads the trace from a random offset, drawn again for all the links every                            무작위 오프셋부터 트레이스를 읽으며, 오프셋은 WindowSize마다 모든 링크에 대해
+ * WindowSize. Only the storage of the trace differs: it is loaded on the first                         다시 뽑힙니다. 트레이스 저장 방식만 다릅니다: 첫 번째 수신 전력 계산 시
+ * computation of a received power, from the shared mapping, instead of being                           인스턴스마다 텍스트 파일을 파싱하는 대신 공유 매핑에서
+ * parsed from the text file by every instance. LteHelper::AssignStreams() only                         로드됩니다. LteHelper::AssignStreams()는 TraceFadingLossModel의
+ * assigns the streams of a TraceFadingLossModel.                                                       스트림만 할당합니다.
+ */
+class MappedTraceFadingLossModel : public SpectrumPropagationLossModel
+{
+  public:
+    /**
+     * \brief Get the type ID.                                                                          타입 ID를 가져옵니다.
+     * \return the object TypeId                                                                        객체 TypeId
+     */
+    static TypeId GetTypeId()
+    {
+        static TypeId tid =
+            TypeId("ns3::MappedTraceFadingLossModel")
+                .SetParent<SpectrumPropagationLossModel>()
+                .SetGroupName("Lte")
+                .AddConstructor<MappedTraceFadingLossModel>()
+                .AddAttribute("TraceFilename",
+                              "Name of file to load a trace from.",
+                              StringValue(""),
+                              MakeStringAccessor(&MappedTraceFadingLossModel::m_traceFile),
+                              MakeStringChecker())
+                .AddAttribute("TraceLength",
+                              "The total length of the fading trace (default value 10 s.)",
+                              TimeValue(Seconds(10.0)),
+                              MakeTimeAccessor(&MappedTraceFadingLossModel::m_traceLength),
+                              MakeTimeChecker())
+                .AddAttribute("SamplesNum",
+                              "The number of samples the trace is made of (default 10000)",
+                              UintegerValue(10000),
+                              MakeUintegerAccessor(&MappedTraceFadingLossModel::m_samplesNum),
+                              MakeUintegerChecker<uint32_t>())
+                .AddAttribute("WindowSize",
+                              "The size of the window for the fading trace (default value 0.5 s.)",
+                              TimeValue(Seconds(0.5)),
+                              MakeTimeAccessor(&MappedTraceFadingLossModel::m_windowSize),
+                              MakeTimeChecker())
+                .AddAttribute("RbNum",
+                              "The number of RB the trace is made of (default 100)",
+                              UintegerValue(100),
+                              MakeUintegerAccessor(&MappedTraceFadingLossModel::m_rbNum),
+                              MakeUintegerChecker<uint32_t>())
+                .AddAttribute("CacheDirectory",
+                              "Directory of the binary copy of the trace, created if needed; "
+                              "the working directory if empty",
+                              StringValue(""),
+                              MakeStringAccessor(&MappedTraceFadingLossModel::m_cacheDir),
+                              MakeStringChecker())
+                .AddAttribute("RngStreamSetSize",
+                              "The number of RNG streams reserved for the fading model. The "
+                              "maximum number of streams that are needed for an LTE FDD "
+                              "scenario is 2 * numUEs * numeNBs.",
+                              UintegerValue(200000),
+                              MakeUintegerAccessor(&MappedTraceFadingLossModel::m_streamSetSize),
+                              MakeUintegerChecker<uint64_t>());
+        return tid;
+    }
+
+  protected:
+    void DoInitialize() override
+    {
+        m_lastWindowUpdate = Simulator::Now();
+        SpectrumPropagationLossModel::DoInitialize();
+    }
+
+  private:
+    /// Identifier of a link                                                                            링크의 식별자
+    typedef std::pair<Ptr<const MobilityModel>, Ptr<const MobilityModel>> ChannelRealizationId_t;
+
+    /// Window of a link                                                                                링크의 창
+    struct Window
+    {
+        Ptr<UniformRandomVariable> start; ///< draws the offset of the window
+        int offset;                       ///< offset of the window [samples]
+    };
+
+    Ptr<SpectrumValue> DoCalcRxPowerSpectralDensity(Ptr<const SpectrumSignalParameters> params,
+                                                    Ptr<const MobilityModel> a,
+                                                    Ptr<const MobilityModel> b) const override
+    {
+        if (!m_trace)
+        {
+            NS_ABORT_MSG_IF(m_samplesNum == 0, "the trace must have at least one sample");
+            m_trace = MappedFadingTrace::Get(m_traceFile, m_rbNum, m_samplesNum, m_cacheDir);
+            m_timeGranularity = m_traceLength.GetMilliSeconds() / m_samplesNum;
+        }
+
+        ChannelRealizationId_t link = std::make_pair(a, b);
+        auto itWindow = m_windows.find(link);
+        if (itWindow != m_windows.end())
+        {
+            if (Simulator::Now().GetSeconds() >=
+                m_lastWindowUpdate.GetSeconds() + m_windowSize.GetSeconds())
+            {
+                // update all the offsets                                                               모든 오프셋을 갱신합니다
+                for (auto& window : m_windows)
+                {
+                    window.second.offset = window.second.start->GetValue();
+                }
+                m_lastWindowUpdate = Simulator::Now();
+            }
+        }
+        else
+        {
+            Ptr<UniformRandomVariable> startV = CreateObject<UniformRandomVariable>();
+            startV->SetAttribute("Min", DoubleValue(1.0));
+            startV->SetAttribute(
+                "Max",
+                DoubleValue((m_traceLength.GetSeconds() - m_windowSize.GetSeconds()) * 1000.0));
+            if (m_streamsAssigned)
+            {
+                NS_ASSERT_MSG(m_currentStream <= m_lastStream,
+                              "not enough streams, consider increasing the StreamSetSize "
+                              "attribute");
+                startV->SetStream(m_currentStream);
+                m_currentStream += 1;
+            }
+            Window window;
+            window.start = startV;
+            window.offset = startV->GetValue();
+            itWindow = m_windows.emplace(link, window).first;
+        }
+
+        Ptr<SpectrumValue> rxPsd = Copy<SpectrumValue>(params->psd);
+        auto it = rxPsd->ValuesBegin();
+        int now_ms = static_cast<int>(Simulator::Now().GetMilliSeconds() * m_timeGranularity);
+        int lastUpdate_ms =
+            static_cast<int>(m_lastWindowUpdate.GetMilliSeconds() * m_timeGranularity);
+        int index = (itWindow->second.offset + now_ms - lastUpdate_ms) % m_samplesNum;
+        uint32_t subChannel = 0;
+        while (it != rxPsd->ValuesEnd())
+        {
+            NS_ASSERT(subChannel < m_rbNum);
+            if (*it != 0.)
+            {
+                double fading = m_trace->GetSample(subChannel, index);
+                double power = *it;                                   // in Watt/Hz
+                power = 10 * std::log10(180000 * power);              // in dB
+                *it = std::pow(10, ((power + fading) / 10)) / 180000; // in Watt
+            }
+            ++it;
+            subChannel++;
+        }
+        return rxPsd;
+    }
+
+    int64_t DoAssignStreams(int64_t stream) override
+    {
+        m_streamsAssigned = true;
+        m_currentStream = stream;
+        m_lastStream = stream + m_streamSetSize - 1;
+        // assign to the already created variables                                                      이미 생성된 변수에 할당합니다
+        for (auto& window : m_windows)
+        {
+            window.second.start->SetStream(m_currentStream);
+            m_currentStream += 1;
+        }
+        return m_streamSetSize;
+    }
+
+    std::string m_traceFile;  ///< the trace file name
+    Time m_traceLength;       ///< the trace length
+    uint32_t m_samplesNum;    ///< the number of samples
+    Time m_windowSize;        ///< the window size
+    uint32_t m_rbNum;         ///< the number of RBs
+    std::string m_cacheDir;   ///< the directory of the binary trace
+    uint64_t m_streamSetSize; ///< the number of streams reserved
+
+    mutable std::shared_ptr<const MappedFadingTrace> m_trace;   ///< the shared trace
+    mutable uint64_t m_timeGranularity{0};                      ///< ms per sample
+    mutable Time m_lastWindowUpdate;                            ///< time of the last window update
+    mutable std::map<ChannelRealizationId_t, Window> m_windows; ///< window of each link
+
+    bool m_streamsAssigned{false};      ///< true if streams have been assigned
+    mutable int64_t m_currentStream{0}; ///< the next stream to assign
+    int64_t m_lastStream{0};            ///< the last stream reserved
+};
+
+NS_OBJECT_ENSURE_REGISTERED(MappedTraceFadingLossModel);
+
+} // namespace ns3
+
+#endif // LENA_MAPPED_FADING_TRACE_H
@@ -0,0 +1,189 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef LENA_MI_BLER_TABLE_H
+#define LENA_MI_BLER_TABLE_H
+
+#include <ns3/abort.h>
+#include <ns3/lte-mi-error-model.h>
+#include <ns3/lte-spectrum-value-helper.h>
+#include <ns3/spectrum-value.h>
+
+#include <cmath>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * Tabulated version of the TB error computation of LteMiErrorModel.                                    LteMiErrorModel의 TB 오류 계산을 표로 만든 버전
+ *
+ * LteMiErrorModel::GetTbDecodificationStats() maps the SINR of every RB to                             LteMiErrorModel::GetTbDecodificationStats()는 모든 RB의 SINR을 변조
+ * mutual information through the tables of the modulation, averages it (MIB)                           방식의 표로 상호 정보량에 매핑하고 평균(MIB)을 낸 뒤, TB의 코드 블록
+ * and maps the MIB to a BLER through the code block segmentation of the TB.                            분할을 통해 MIB를 BLER로 매핑합니다. RB별 매핑은 이미 균일 간격의 선형
+ * The per-RB mapping is already a lookup in uniformly spaced linear-SINR                               SINR 표 조회이므로, MIB는 LteMiErrorModel::Mib()로 그대로 계산합니다.
+ * tables, so the MIB is still computed by LteMiErrorModel::Mib(). The TB BLER                          TB BLER는 (MCS, TB 크기, MIB)에만 의존하므로 MIB를 구간으로 나누어
+ * only depends on (MCS, TB size, MIB), so it is memoized per MIB bucket: a                             구간별로 메모이즈합니다. 각 구간은 MI가 구간 중심과 같은 평탄한 SINR로
+ * bucket is computed once, by LteMiErrorModel on a flat SINR whose MI is the                           LteMiErrorModel을 한 번 호출하여 계산합니다. 그 SINR은 MCS별로 dB 격자에서
+ * center of the bucket. That SINR is found by inverting the MI curve of the                            한 번 샘플링한 MI 곡선을 역으로 풀어 찾습니다.
+ * MCS, sampled once on a dB grid.
+ *
+ * The result is an approximation of the model (MIB quantization);                                      결과는 모델의 근사치입니다(MIB 양자화). lena-mi-error-benchmark가
+ * lena-mi-error-benchmark reports its error. HARQ retransmissions (miHistory)                          그 오차를 보고합니다. HARQ 재전송(miHistory)은 다루지 않으며
+ * are not covered and stay with LteMiErrorModel.                                                       LteMiErrorModel에 남습니다.
+ */
+class MiBlerTable
+{
+  public:
+    /**
+     * The grid samples the MI curves that give the SINR of each MIB bucket.                           격자는 각 MIB 구간의 SINR을 구하는 MI 곡선을 샘플링합니다.
+     *
+     * \param minSinrDb the lowest SINR of the grid [dB]                                                격자의 최저 SINR [dB]
+     * \param maxSinrDb the highest SINR of the grid [dB]                                               격자의 최고 SINR [dB]
+     * \param stepDb the step of the grid [dB]                                                          격자 간격 [dB]
+     * \param mibStep the width of the MIB buckets                                                      MIB 구간의 폭
+     */
+    MiBlerTable(double minSinrDb = -20.0,
+                double maxSinrDb = 40.0,
+                double stepDb = 0.05,
+                double mibStep = 1e-3)
+        : m_minSinrDb(minSinrDb),
+          m_stepDb(stepDb),
+          m_nPoints(std::lround((maxSinrDb - minSinrDb) / stepDb) + 1),
+          m_mibStep(mibStep),
+          m_mi(MCS_NUM)
+    {
+        NS_ABORT_MSG_IF(maxSinrDb <= minSinrDb || stepDb <= 0 || mibStep <= 0, "invalid grid");
+        m_rbModel = LteSpectrumValueHelper::GetSpectrumModel(100, 6);
+    }
+
+    /**
+     * Same as LteMiErrorModel::GetTbDecodificationStats().tbler without HARQ                           HARQ 이력이 없는 LteMiErrorModel::GetTbDecodificationStats().tbler와 같음
+     * history.
+     *
+     * \param sinr the per-RB SINR (linear)                                                             RB별 SINR (선형)
+     * \param map the RBs of the TB                                                                     TB의 RB들
+     * \param size the TB size [bytes]                                                                  TB 크기 [바이트]
+     * \param mcs the MCS                                                                               MCS
+     * \return the TB error rate                                                                        TB 오류율
+     */
+    double GetTbler(const SpectrumValue& sinr,
+                    const std::vector<int>& map,
+                    uint16_t size,
+                    uint8_t mcs)
+    {
+        uint64_t bucket = static_cast<uint64_t>(LteMiErrorModel::Mib(sinr, map, mcs) / m_mibStep);
+        uint64_t key = (static_cast<uint64_t>(mcs) << 48) | (static_cast<uint64_t>(size) << 32) |
+                       bucket;
+        ++m_lookups;
+        auto it = m_tbler.find(key);
+        if (it != m_tbler.end())
+        {
+            ++m_hits;
+            return it->second;
+        }
+        SpectrumValue flatSinr(m_rbModel);
+        flatSinr[0] = SinrOfMi((bucket + 0.5) * m_mibStep, mcs);
+        double tbler = LteMiErrorModel::GetTbDecodificationStats(flatSinr,
+                                                                 std::vector<int>(1, 0),
+                                                                 size,
+                                                                 mcs,
+                                                                 HarqProcessInfoList_t())
+                           .tbler;
+        m_tbler.emplace(key, tbler);
+        return tbler;
+    }
+
+    /**
+     * \return the share of the GetTbler() calls answered from a computed bucket                        이미 계산된 구간으로 응답한 GetTbler() 호출의 비율
+     */
+    double GetHitRate() const
+    {
+        return m_lookups > 0 ? static_cast<double>(m_hits) / m_lookups : 0.0;
+    }
+
+  private:
+    /// Number of MCSs of the LTE tables                                                                LTE 표의 MCS 수
+    static constexpr uint8_t MCS_NUM = 29;
+
+    /**
+     * Get the MI curve of an MCS, sampling it the first time.                                          MCS의 MI 곡선을 가져옵니다. 처음에는 샘플링합니다.
+     *
+     * \param mcs the MCS                                                                               MCS
+     * \return the MI at each point of the grid                                                         격자의 각 점에서의 MI
+     */
+    const std::vector<double>& GetMiCurve(uint8_t mcs)
+    {
+        NS_ABORT_MSG_IF(mcs >= MCS_NUM, "invalid MCS " << +mcs);
+        std::vector<double>& mi = m_mi[mcs];
+        if (mi.empty())
+        {
+            mi.resize(m_nPoints);
+            SpectrumValue sinr(m_rbModel);
+            std::vector<int> map(1, 0);
+            for (std::size_t i = 0; i < m_nPoints; ++i)
+            {
+                sinr[0] = std::pow(10.0, (m_minSinrDb + i * m_stepDb) / 10);
+                mi[i] = LteMiErrorModel::Mib(sinr, map, mcs);
+            }
+        }
+        return mi;
+    }
+
+    /**
+     * Inverse of the MI curve of an MCS.                                                               MCS의 MI 곡선의 역함수
+     *
+     * \param mi the mutual information per bit                                                         비트당 상호 정보량
+     * \param mcs the MCS                                                                               MCS
+     * \return the linear SINR whose MI is mi, clamped to the grid                                      MI가 mi인 선형 SINR (격자 범위로 제한)
+     */
+    double SinrOfMi(double mi, uint8_t mcs)
+    {
+        const std::vector<double>& curve = GetMiCurve(mcs);
+        std::size_t lo = 0;
+        std::size_t hi = m_nPoints - 1;
+        if (mi <= curve[lo])
+        {
+            hi = lo;
+        }
+        else if (mi >= curve[hi])
+        {
+            lo = hi;
+        }
+        while (hi - lo > 1)
+        {
+            std::size_t mid = (lo + hi) / 2;
+            (curve[mid] < mi ? lo : hi) = mid;
+        }
+        double frac = curve[hi] > curve[lo] ? (mi - curve[lo]) / (curve[hi] - curve[lo]) : 0.0;
+        return std::pow(10.0, (m_minSinrDb + (lo + frac * (hi - lo)) * m_stepDb) / 10);
+    }
+
+    double m_minSinrDb;                           ///< lowest SINR of the grid [dB]
+    double m_stepDb;                              ///< step of the grid [dB]
+    std::size_t m_nPoints;                        ///< points of the grid
+    double m_mibStep;                             ///< width of the MIB buckets
+    Ptr<const SpectrumModel> m_rbModel;           ///< spectrum model of the flat SINRs
+    std::vector<std::vector<double>> m_mi;        ///< MI curve per MCS, empty until used
+    std::unordered_map<uint64_t, double> m_tbler; ///< TB BLER per (MCS, TB size, MIB bucket)
+    uint64_t m_lookups{0};                        ///< number of GetTbler() calls
+    uint64_t m_hits{0};                           ///< calls answered from m_tbler
+};
+
+} // namespace ns3
+
+#endif // LENA_MI_BLER_TABLE_H
@@ -0,0 +1,152 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "lena-mi-bler-table.h"
+
+#include "ns3/core-module.h"
+#include "ns3/lte-module.h"
+#include "ns3/spectrum-module.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE("LenaMiErrorBenchmark");
+
+/**
+ * Microbenchmark of the TB error computation of the data error model: the                              데이터 오류 모델의 TB 오류 계산 마이크로벤치마크:
+ * LteMiErrorModel::GetTbDecodificationStats() call done by LteSpectrumPhy for                          LteSpectrumPhy가 수신한 모든 TB에 대해 호출하는
+ * every TB received, against the tabulated MiBlerTable of lena-mi-bler-table.h,                        LteMiErrorModel::GetTbDecodificationStats()와 lena-mi-bler-table.h의
+ * on random per-RB SINRs and MCSs. Besides the TBs per second of both, the                             표 기반 MiBlerTable을 무작위 RB별 SINR과 MCS에서 비교합니다. 두 방식의
+ * maximum and mean absolute errors of the table on the TB BLER are reported,                           초당 TB 수와 함께, 표의 TB BLER 최대 및 평균 절대 오차를 보고하여
+ * so that the MIB bucket size can be audited; the MIB itself is exact, as both                         MIB 구간 크기를 점검할 수 있게 합니다. MIB 자체는 두 방식 모두
+ * compute it with LteMiErrorModel::Mib().                                                              LteMiErrorModel::Mib()로 계산하므로 정확합니다.
+ *
+ * Every TB gets freshly drawn SINRs, RBs and MCS, so the table is timed on                             모든 TB는 새로 뽑은 SINR, RB, MCS를 받으므로 표는 새 입력에서
+ * new inputs; it still only pays LteMiErrorModel once per (MCS, TB size, MIB                           측정됩니다. 그래도 표는 (MCS, TB 크기, MIB 구간)마다 한 번만
+ * bucket). The hit rate of those buckets is reported next to the speedup,                              LteMiErrorModel을 호출합니다. 속도 향상은 그 구간이 재사용될 때만
+ * which only holds while buckets are reused: a wider SINR or TB size range, or                         유효하므로 구간 적중률을 속도 향상 옆에 보고합니다. 더 넓은 SINR이나
+ * fewer TBs, lower the hit rate and the speedup.                                                       TB 크기 범위, 또는 더 적은 TB는 적중률과 속도 향상을 낮춥니다.
+ *
+ * ./ns3 run "lena-mi-error-benchmark --nTbs=100000 --meanSinrDb=10"
+ */
+int
+main(int argc, char* argv[])
+{
+    uint32_t nTbs = 100000;                                                                             // 평가할 TB 수
+    uint16_t nRbs = 100;                                                                                // 대역폭의 RB 수
+    uint16_t tbRbs = 25;                                                                                // TB당 RB 수
+    double meanSinrDb = 10.0;                                                                           // 평균 SINR [dB]
+    double sinrSpreadDb = 10.0;                                                                         // RB별 SINR 범위 [dB]
+    double mibStep = 1e-3;                                                                              // MIB 구간의 폭
+
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("nTbs", "Number of TBs evaluated", nTbs);                                              // 평가할 TB 수
+    cmd.AddValue("nRbs", "Number of resource blocks of the bandwidth", nRbs);                           // 대역폭의 RB 수
+    cmd.AddValue("tbRbs", "Number of resource blocks per TB", tbRbs);                                   // TB당 RB 수
+    cmd.AddValue("meanSinrDb", "Mean SINR of the RBs [dB]", meanSinrDb);                                // RB의 평균 SINR [dB]
+    cmd.AddValue("sinrSpreadDb",
+                 "Width of the uniform distribution of the per-RB SINR [dB]",                           // RB별 SINR 균일 분포의 폭 [dB]
+                 sinrSpreadDb);
+    cmd.AddValue("mibStep", "Width of the MIB buckets of the table", mibStep);                          // 표의 MIB 구간 폭
+    cmd.Parse(argc, argv);
+
+    NS_ABORT_MSG_IF(nTbs == 0, "at least one TB is needed");
+    NS_ABORT_MSG_IF(tbRbs == 0 || tbRbs > nRbs, "tbRbs must be in [1, nRbs]");
+
+    // fresh random per-RB SINRs, TB positions and MCSs for every TB, drawn by                          모든 TB마다 새로 뽑는 무작위 RB별 SINR, TB 위치, MCS.
+    // batches out of the timed loops                                                                   시간을 재는 루프 밖에서 묶음으로 뽑습니다
+    const uint32_t batchSize = 1024;
+    Ptr<SpectrumModel> sm = LteSpectrumValueHelper::GetSpectrumModel(100, nRbs);
+    Ptr<UniformRandomVariable> rv = CreateObject<UniformRandomVariable>();
+    Ptr<LteAmc> amc = CreateObject<LteAmc>();
+    MiBlerTable table(-20.0, 40.0, 0.05, mibStep);
+    std::chrono::duration<double> exactTime(0);
+    std::chrono::duration<double> tableTime(0);
+    double maxError = 0;
+    double sumError = 0;
+    for (uint32_t first = 0; first < nTbs; first += batchSize)
+    {
+        uint32_t nSamples = std::min(batchSize, nTbs - first);
+        std::vector<SpectrumValue> sinrs;
+        std::vector<std::vector<int>> maps;
+        std::vector<uint8_t> mcss;
+        std::vector<uint16_t> sizes;
+        for (uint32_t i = 0; i < nSamples; ++i)
+        {
+            SpectrumValue sinr(sm);
+            for (auto it = sinr.ValuesBegin(); it != sinr.ValuesEnd(); ++it)
+            {
+                double sinrDb = meanSinrDb + sinrSpreadDb * (rv->GetValue() - 0.5);
+                *it = std::pow(10.0, sinrDb / 10);
+            }
+            sinrs.push_back(sinr);
+            uint32_t firstRb = rv->GetInteger(0, nRbs - tbRbs);
+            std::vector<int> map;
+            for (uint16_t rb = 0; rb < tbRbs; ++rb)
+            {
+                map.push_back(firstRb + rb);
+            }
+            maps.push_back(map);
+            mcss.push_back(rv->GetInteger(0, 28));
+            sizes.push_back(amc->GetDlTbSizeFromMcs(mcss.back(), tbRbs) / 8);
+        }
+
+        std::vector<double> exact(nSamples);
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < nSamples; ++i)
+        {
+            exact[i] = LteMiErrorModel::GetTbDecodificationStats(sinrs[i],
+                                                                 maps[i],
+                                                                 sizes[i],
+                                                                 mcss[i],
+                                                                 HarqProcessInfoList_t())
+                           .tbler;
+        }
+        exactTime += std::chrono::steady_clock::now() - start;
+
+        std::vector<double> tabulated(nSamples);
+        start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < nSamples; ++i)
+        {
+            tabulated[i] = table.GetTbler(sinrs[i], maps[i], sizes[i], mcss[i]);
+        }
+        tableTime += std::chrono::steady_clock::now() - start;
+
+        for (uint32_t i = 0; i < nSamples; ++i)
+        {
+            double error = std::abs(exact[i] - tabulated[i]);
+            maxError = std::max(maxError, error);
+            sumError += error;
+        }
+    }
+
+    std::cout << "TBs " << nTbs << ", RBs per TB " << tbRbs << ", SINR " << meanSinrDb << " +/- "
+              << sinrSpreadDb / 2 << " dB" << std::endl;
+    std::cout << std::fixed << std::setprecision(0);
+    std::cout << "LteMiErrorModel: " << nTbs / exactTime.count() << " TBs/s" << std::endl;
+    std::cout << "MiBlerTable:     " << nTbs / tableTime.count() << " TBs/s (table setup included)"
+              << std::endl;
+    std::cout << std::setprecision(2) << "speedup: " << exactTime.count() / tableTime.count()
+              << ", MIB bucket hit rate " << 100 * table.GetHitRate() << " %"
+              << std::setprecision(5) << ", TB BLER error max " << maxError << ", mean "
+              << sumError / nTbs << std::endl;
+    return 0;
+}
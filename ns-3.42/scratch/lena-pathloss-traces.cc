@@ -18,6 +18,8 @@
  *         Nicola Baldo <nbaldo@cttc.es>
  */
 
+#include "lena-batch-runs.h"
+
 #include "ns3/config-store.h"
 #include "ns3/core-module.h"
 #include "ns3/lte-global-pathloss-database.h"
@@ -34,36 +36,26 @@ using namespace ns3;
 
 NS_LOG_COMPONENT_DEFINE("LenaPathlossTraces");
 
-int
-main(int argc, char* argv[])
+/**
+ * Simulate one run of the scenario.                                                                시나리오의 한 번의 실행을 시뮬레이션합니다.
+ *
+ * \param run the RngRun value of this run                                                          이번 실행의 RngRun 값
+ * \param nRuns the number of runs simulated in this process                                        이 프로세스에서 시뮬레이션하는 실행 수
+ * \param enbDist the distance between the two eNBs [m]                                             eNB 간 거리 [m]
+ * \param radius the radius of the disc where UEs are placed around an eNB [m]                      각 eNB 주변의 UE 위치를 정의하는 원의 반지름 [m]
+ * \param numUes the number of UEs attached to each eNB                                             각 eNB에 연결될 UE 수
+ */
+void
+RunOnce(uint64_t run, uint32_t nRuns, double enbDist, double radius, uint32_t numUes)
 {
-    double enbDist = 20.0;                                                                          // eNB 간 거리
-    double radius = 10.0;                                                                           // 각 eNB 주변의 UE 위치를 정의하는 원의 반지름
-    uint32_t numUes = 1;                                                                            // 각 eNB에 연결될 UE 수
-
-    CommandLine cmd(__FILE__);
-    cmd.AddValue("enbDist", "distance between the two eNBs", enbDist);
-    cmd.AddValue("radius", "the radius of the disc where UEs are placed around an eNB", radius);
-    cmd.AddValue("numUes", "how many UEs are attached to each eNB", numUes);
-    cmd.Parse(argc, argv);
-
-    ConfigStore inputConfig;
-    inputConfig.ConfigureDefaults();
-
-    // parse again so you can override default values from the command line                         명령줄에서 기본값을 재설정할 수 있도록 다시 파싱합니다.
-    cmd.Parse(argc, argv);
-
     // determine the string tag that identifies this simulation run                                 시뮬레이션 실행을 식별하는 태그 문자열 생성
     // this tag is then appended to all filenames
 
-    UintegerValue runValue;
-    GlobalValue::GetValueByName("RngRun", runValue);
-
     std::ostringstream tag;
     tag << "_enbDist" << std::setw(3) << std::setfill('0') << std::fixed << std::setprecision(0)
         << enbDist << "_radius" << std::setw(3) << std::setfill('0') << std::fixed
         << std::setprecision(0) << radius << "_numUes" << std::setw(3) << std::setfill('0')
-        << numUes << "_rngRun" << std::setw(3) << std::setfill('0') << runValue.Get();
+        << numUes << "_rngRun" << std::setw(3) << std::setfill('0') << run;
 
     Ptr<LteHelper> lteHelper = CreateObject<LteHelper>();
 
@@ -149,6 +141,19 @@ main(int argc, char* argv[])
     std::string ulOutFname = "UlRlcStats";
     ulOutFname.append(tag.str());
 
+    if (nRuns > 1)
+    {
+        // keep the MAC and RLC statistics of every run                                             모든 실행의 MAC 및 RLC 통계를 보존합니다
+        Config::SetDefault("ns3::MacStatsCalculator::DlOutputFilename",
+                           StringValue("DlMacStats" + tag.str() + ".txt"));
+        Config::SetDefault("ns3::MacStatsCalculator::UlOutputFilename",
+                           StringValue("UlMacStats" + tag.str() + ".txt"));
+        Config::SetDefault("ns3::RadioBearerStatsCalculator::DlRlcOutputFilename",
+                           StringValue(dlOutFname + ".txt"));
+        Config::SetDefault("ns3::RadioBearerStatsCalculator::UlRlcOutputFilename",
+                           StringValue(ulOutFname + ".txt"));
+    }
+
     lteHelper->EnableMacTraces();
     lteHelper->EnableRlcTraces();
 
@@ -166,11 +171,41 @@ main(int argc, char* argv[])
     Simulator::Run();
 
     // print the pathloss values at the end of the simulation                                       시뮬레이션 종료 후 경로손실 값 출력
+    if (nRuns > 1)
+    {
+        std::cout << std::endl << "RngRun " << run << std::endl;
+    }
     std::cout << std::endl << "Downlink pathloss:" << std::endl;
     dlPathlossDb.Print();
     std::cout << std::endl << "Uplink pathloss:" << std::endl;
     ulPathlossDb.Print();
+}
+
+int
+main(int argc, char* argv[])
+{
+    double enbDist = 20.0;                                                                          // eNB 간 거리
+    double radius = 10.0;                                                                           // 각 eNB 주변의 UE 위치를 정의하는 원의 반지름
+    uint32_t numUes = 1;                                                                            // 각 eNB에 연결될 UE 수
+    uint32_t nRuns = 1;                                                                             // 이 프로세스에서 실행할 RngRun 값의 수
+
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("enbDist", "distance between the two eNBs", enbDist);
+    cmd.AddValue("radius", "the radius of the disc where UEs are placed around an eNB", radius);
+    cmd.AddValue("numUes", "how many UEs are attached to each eNB", numUes);
+    cmd.AddValue("nRuns",
+                 "how many consecutive RngRun values, starting from RngRun, are simulated "
+                 "in this process",
+                 nRuns);
+    cmd.Parse(argc, argv);
+
+    ConfigStore inputConfig;
+    inputConfig.ConfigureDefaults();
+
+    // parse again so you can override default values from the command line                         명령줄에서 기본값을 재설정할 수 있도록 다시 파싱합니다.
+    cmd.Parse(argc, argv);
+
+    RunBatch(nRuns, [&](uint64_t run) { RunOnce(run, nRuns, enbDist, radius, numUes); });
 
-    Simulator::Destroy();
     return 0;
 }
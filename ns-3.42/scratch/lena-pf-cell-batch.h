@@ -0,0 +1,181 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef LENA_PF_CELL_BATCH_H
+#define LENA_PF_CELL_BATCH_H
+
+#include "lena-pf-scheduler-kernel.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * Schedule the DL of many cells together, once per TTI.                                                여러 셀의 DL을 TTI마다 한 번에 함께 스케줄링합니다.
+ *
+ * Instead of one scheduler call per cell through the SAP, the engine keeps the                         셀마다 SAP를 통해 스케줄러를 한 번씩 호출하는 대신, 엔진은 모든 셀의
+ * PfRbgScheduler of every cell, sharing the same link adaptation tables, and                           PfRbgScheduler를 같은 링크 적응 테이블을 공유하며 보관하고,
+ * ScheduleAll() decides the allocations of all of them for the TTI. The cells                          ScheduleAll()이 해당 TTI에 대한 모든 셀의 할당을 결정합니다. 셀은
+ * are independent, so they can be spread across worker threads: the workers                            서로 독립적이므로 작업 스레드에 나눌 수 있습니다. 작업 스레드는
+ * are started once and woken up every TTI, cell i being always scheduled by                            한 번 시작되어 TTI마다 깨어나며, 셀 i는 항상 i % nShares 스레드가
+ * thread i % nShares (the calling thread being share 0). The allocations are                           스케줄링합니다(호출 스레드는 0번). 할당은 스레드 수와 관계없이
+ * the same whatever the number of threads.                                                             동일합니다.
+ *
+ * The cells are to be added, and their CQIs set, by the calling thread, never                          셀 추가와 CQI 설정은 호출 스레드가 하며, ScheduleAll() 실행 중에는
+ * during ScheduleAll().                                                                                하지 않아야 합니다.
+ */
+class PfCellBatch
+{
+  public:
+    /**
+     * \param tables the link adaptation tables shared by the cells                                     셀들이 공유하는 링크 적응 테이블
+     * \param nThreads the number of threads scheduling the cells, the calling one included             셀을 스케줄링하는 스레드 수 (호출 스레드 포함)
+     */
+    explicit PfCellBatch(const PfLinkTables& tables, uint32_t nThreads = 1)
+        : m_tables(tables),
+          m_nShares(nThreads == 0 ? 1 : nThreads)
+    {
+        for (uint32_t share = 1; share < m_nShares; ++share)
+        {
+            m_workers.emplace_back(&PfCellBatch::WorkerLoop, this, share);
+        }
+    }
+
+    ~PfCellBatch()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_start.notify_all();
+        for (auto& worker : m_workers)
+        {
+            worker.join();
+        }
+    }
+
+    PfCellBatch(const PfCellBatch&) = delete;
+    PfCellBatch& operator=(const PfCellBatch&) = delete;
+
+    /**
+     * Add a cell.                                                                                      셀을 추가합니다.
+     *
+     * \param nRbgs the number of RBGs                                                                  RBG 수
+     * \param rbgSize the number of PRBs per RBG                                                        RBG당 PRB 수
+     * \return the scheduler of the cell, to add its UEs and set their CQIs                             UE 추가와 CQI 설정에 쓰는 셀의 스케줄러
+     */
+    PfRbgScheduler& AddCell(uint16_t nRbgs, uint16_t rbgSize)
+    {
+        m_cells.push_back(std::make_unique<PfRbgScheduler>(m_tables, nRbgs, rbgSize));
+        return *m_cells.back();
+    }
+
+    /**
+     * \param cell the index of the cell, in the order of AddCell()                                     셀 인덱스 (AddCell() 순서)
+     * \return the scheduler of the cell                                                                셀의 스케줄러
+     */
+    PfRbgScheduler& GetCell(std::size_t cell)
+    {
+        return *m_cells.at(cell);
+    }
+
+    /// \return the number of cells                                                                     셀 수
+    std::size_t GetNCells() const
+    {
+        return m_cells.size();
+    }
+
+    /// Schedule one TTI of all the cells                                                               모든 셀의 한 TTI를 스케줄링합니다.
+    void ScheduleAll()
+    {
+        if (m_workers.empty())
+        {
+            ScheduleShare(0);
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            ++m_generation;
+            m_pending = m_workers.size();
+        }
+        m_start.notify_all();
+        ScheduleShare(0);
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_done.wait(lock, [this] { return m_pending == 0; });
+    }
+
+  private:
+    /**
+     * Schedule the cells of one share.                                                                 한 몫에 속한 셀들을 스케줄링합니다.
+     *
+     * \param share the share, in [0, nThreads)                                                         몫 번호 [0, nThreads)
+     */
+    void ScheduleShare(uint32_t share)
+    {
+        for (std::size_t cell = share; cell < m_cells.size(); cell += m_nShares)
+        {
+            m_cells[cell]->Schedule();
+        }
+    }
+
+    /**
+     * Loop of a worker thread, scheduling its share once per TTI.                                      TTI마다 자신의 몫을 스케줄링하는 작업 스레드 루프
+     *
+     * \param share the share of the worker                                                             작업 스레드의 몫
+     */
+    void WorkerLoop(uint32_t share)
+    {
+        uint64_t generation = 0;
+        while (true)
+        {
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_start.wait(lock, [&] { return m_stop || m_generation != generation; });
+                if (m_stop)
+                {
+                    return;
+                }
+                generation = m_generation;
+            }
+            ScheduleShare(share);
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (--m_pending == 0)
+            {
+                m_done.notify_one();
+            }
+        }
+    }
+
+    const PfLinkTables& m_tables;                         ///< link adaptation tables
+    uint32_t m_nShares;                                   ///< number of scheduling threads
+    std::vector<std::unique_ptr<PfRbgScheduler>> m_cells; ///< scheduler of each cell
+    std::vector<std::thread> m_workers;                   ///< worker threads, shares 1 and above
+    std::mutex m_mutex;                                   ///< protects the fields below
+    std::condition_variable m_start;                      ///< wakes up the workers
+    std::condition_variable m_done;                       ///< wakes up the calling thread
+    uint64_t m_generation{0};                             ///< TTIs started
+    std::size_t m_pending{0};                             ///< workers still scheduling the TTI
+    bool m_stop{false};                                   ///< the workers are to exit
+};
+
+} // namespace ns3
+
+#endif // LENA_PF_CELL_BATCH_H
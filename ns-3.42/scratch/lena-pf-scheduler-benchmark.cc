@@ -0,0 +1,492 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "lena-pf-cell-batch.h"
+#include "lena-pf-scheduler-kernel.h"
+
+#include "ns3/core-module.h"
+#include "ns3/lte-module.h"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE("LenaPfSchedulerBenchmark");
+
+/**
+ * DL allocation of PfFfMacScheduler::DoSchedDlTriggerReq() with its own data                           PfFfMacScheduler::DoSchedDlTriggerReq()의 DL 할당을 원래의 자료 구조로
+ * structures: per-RNTI std::map state, a copy of the subband CQI vector per UE                         구현한 것: RNTI별 std::map 상태, RBG와 UE마다 서브밴드 CQI 벡터 복사,
+ * and RBG, allocation and RBG maps built every TTI, and the CQI timers                                 TTI마다 새로 만드는 할당 맵과 RBG 맵, 그리고 TTI마다 모든 UE에 대해
+ * decremented for every UE every TTI (RefreshDlCqiMaps()).                                             감소하는 CQI 타이머(RefreshDlCqiMaps())
+ */
+class MapPfScheduler
+{
+  public:
+    /**
+     * \param amc the AMC module                                                                        AMC 모듈
+     * \param nRbgs the number of RBGs                                                                  RBG 수
+     * \param rbgSize the number of PRBs per RBG                                                        RBG당 PRB 수
+     */
+    MapPfScheduler(Ptr<LteAmc> amc, uint16_t nRbgs, uint16_t rbgSize)
+        : m_amc(amc),
+          m_nRbgs(nRbgs),
+          m_rbgSize(rbgSize)
+    {
+    }
+
+    /**
+     * \param rnti the RNTI                                                                             RNTI
+     */
+    void AddUe(uint16_t rnti)
+    {
+        m_flowStats[rnti] = FlowStats();
+    }
+
+    /**
+     * \param threshold the number of TTIs a CQI report is valid                                        CQI 보고가 유효한 TTI 수
+     */
+    void SetCqiTimerThreshold(uint16_t threshold)
+    {
+        m_cqiTimersThreshold = threshold;
+    }
+
+    /**
+     * \param rnti the RNTI                                                                             RNTI
+     * \param sbCqi the CQI of each RBG                                                                 각 RBG의 CQI
+     */
+    void SetSubbandCqi(uint16_t rnti, const uint8_t* sbCqi)
+    {
+        m_sbCqi[rnti] = std::vector<uint8_t>(sbCqi, sbCqi + m_nRbgs);
+        m_cqiTimers[rnti] = m_cqiTimersThreshold;
+    }
+
+    /// Allocate the RBGs of one TTI and update the averaged throughputs                                한 TTI의 RBG를 할당하고 평균 처리량을 갱신합니다.
+    void Schedule()
+    {
+        for (auto itCqi = m_cqiTimers.begin(); itCqi != m_cqiTimers.end();)
+        {
+            if (itCqi->second == 0)
+            {
+                m_sbCqi.erase(itCqi->first);
+                itCqi = m_cqiTimers.erase(itCqi);
+            }
+            else
+            {
+                itCqi->second--;
+                itCqi++;
+            }
+        }
+
+        std::map<uint16_t, std::vector<uint16_t>> allocationMap;
+        std::vector<bool> rbgMap(m_nRbgs, false);
+        for (uint16_t i = 0; i < m_nRbgs; i++)
+        {
+            auto itMax = m_flowStats.end();
+            double rcqiMax = 0.0;
+            for (auto it = m_flowStats.begin(); it != m_flowStats.end(); it++)
+            {
+                auto itCqi = m_sbCqi.find(it->first);
+                std::vector<uint8_t> sbCqi;
+                if (itCqi == m_sbCqi.end())
+                {
+                    sbCqi.push_back(1); // start with lowest value
+                }
+                else
+                {
+                    sbCqi.push_back(itCqi->second.at(i));
+                }
+                if (sbCqi.at(0) > 0)
+                {
+                    uint8_t mcs = m_amc->GetMcsFromCqi(sbCqi.at(0));
+                    double achievableRate =
+                        ((m_amc->GetDlTbSizeFromMcs(mcs, m_rbgSize) / 8) / 0.001);
+                    double rcqi = achievableRate / it->second.lastAveragedThroughput;
+                    if (rcqi > rcqiMax)
+                    {
+                        rcqiMax = rcqi;
+                        itMax = it;
+                    }
+                }
+            }
+            if (itMax != m_flowStats.end())
+            {
+                allocationMap[itMax->first].push_back(i);
+                rbgMap.at(i) = true;
+            }
+        }
+        m_rbgOwner = std::vector<uint16_t>(m_nRbgs, PfRbgScheduler::NO_UE);
+
+        for (auto itMap = allocationMap.begin(); itMap != allocationMap.end(); itMap++)
+        {
+            uint8_t worstCqi = 15;
+            auto itCqi = m_sbCqi.find(itMap->first);
+            for (std::size_t k = 0; k < itMap->second.size(); k++)
+            {
+                m_rbgOwner[itMap->second.at(k)] = itMap->first;
+                if (itCqi == m_sbCqi.end())
+                {
+                    worstCqi = 1;
+                }
+                else if (itCqi->second.at(itMap->second.at(k)) < worstCqi)
+                {
+                    worstCqi = itCqi->second.at(itMap->second.at(k));
+                }
+            }
+            uint8_t mcs = m_amc->GetMcsFromCqi(worstCqi);
+            int tbSize = m_amc->GetDlTbSizeFromMcs(mcs, itMap->second.size() * m_rbgSize) / 8;
+            m_flowStats[itMap->first].lastTtiBytesTransmitted = tbSize;
+        }
+
+        for (auto itStats = m_flowStats.begin(); itStats != m_flowStats.end(); itStats++)
+        {
+            itStats->second.lastAveragedThroughput =
+                ((1.0 - (1.0 / m_timeWindow)) * itStats->second.lastAveragedThroughput) +
+                ((1.0 / m_timeWindow) * (double)(itStats->second.lastTtiBytesTransmitted / 0.001));
+            itStats->second.lastTtiBytesTransmitted = 0;
+        }
+    }
+
+    /**
+     * \param rbg the RBG                                                                               RBG
+     * \return the RNTI the RBG was allocated to in the last TTI, or NO_UE                              마지막 TTI에서 RBG가 할당된 RNTI, 또는 NO_UE
+     */
+    uint16_t GetRbgOwner(uint16_t rbg) const
+    {
+        return m_rbgOwner[rbg];
+    }
+
+    /**
+     * \param rnti the RNTI                                                                             RNTI
+     * \return the averaged throughput of the UE [byte/s]                                               UE의 평균 처리량 [byte/s]
+     */
+    double GetAveragedThroughput(uint16_t rnti) const
+    {
+        return m_flowStats.at(rnti).lastAveragedThroughput;
+    }
+
+  private:
+    /// PF flow statistics, as pfsFlowPerf_t                                                            pfsFlowPerf_t와 같은 PF 흐름 통계
+    struct FlowStats
+    {
+        double lastAveragedThroughput{1};        ///< averaged throughput [byte/s]
+        unsigned int lastTtiBytesTransmitted{0}; ///< bytes transmitted in the last TTI
+    };
+
+    Ptr<LteAmc> m_amc;                                ///< AMC module
+    uint16_t m_nRbgs;                                 ///< number of RBGs
+    uint16_t m_rbgSize;                               ///< PRBs per RBG
+    double m_timeWindow{99.0};                        ///< time window of the averaged throughput
+    std::map<uint16_t, FlowStats> m_flowStats;        ///< flow statistics per RNTI
+    std::map<uint16_t, std::vector<uint8_t>> m_sbCqi; ///< subband CQI per RNTI
+    std::map<uint16_t, uint32_t> m_cqiTimers;         ///< CQI timer per RNTI [TTI]
+    uint16_t m_cqiTimersThreshold{1000};              ///< TTIs a CQI report is valid
+    std::vector<uint16_t> m_rbgOwner;                 ///< RNTI of the owner of each RBG
+};
+
+/**
+ * Whether a UE reports its subband CQI in a TTI. Every fourth UE reports with                          UE가 TTI에서 서브밴드 CQI를 보고하는지 여부. 네 번째 UE마다 느린 주기로
+ * the slow period, so that its CQI expires when that period is longer than the                         보고하므로, 그 주기가 CQI 타이머보다 길면 CQI가 만료되어 만료 경로와
+ * CQI timer, exercising the expiry and the fallback to CQI 1.                                          CQI 1로의 대체를 검사합니다.
+ *
+ * \param ue the UE index                                                                               UE 인덱스
+ * \param tti the TTI                                                                                   TTI
+ * \param cqiPeriod the CQI reporting period of the other UEs [TTI]                                     다른 UE들의 CQI 보고 주기 [TTI]
+ * \param slowCqiPeriod the CQI reporting period of every fourth UE [TTI]                               네 번째 UE마다의 CQI 보고 주기 [TTI]
+ * \return true if the UE reports                                                                       UE가 보고하면 참
+ */
+inline bool
+ReportsCqi(uint16_t ue, uint32_t tti, uint32_t cqiPeriod, uint32_t slowCqiPeriod)
+{
+    return (ue + tti) % (ue % 4 == 3 ? slowCqiPeriod : cqiPeriod) == 0;
+}
+
+/**
+ * Run a scheduler for a number of TTIs.                                                                스케줄러를 여러 TTI 동안 실행합니다.
+ *
+ * \param scheduler the scheduler, with its UEs (RNTI 1..nUes) added                                    UE(RNTI 1..nUes)가 추가된 스케줄러
+ * \param cqiPool the subband CQI reports, nRbgs values each                                            서브밴드 CQI 보고 (각각 nRbgs개 값)
+ * \param nUes the number of UEs                                                                        UE 수
+ * \param nRbgs the number of RBGs                                                                      RBG 수
+ * \param nTtis the number of TTIs                                                                      TTI 수
+ * \param cqiPeriod the CQI reporting period of the UEs [TTI]                                           UE들의 CQI 보고 주기 [TTI]
+ * \param slowCqiPeriod the CQI reporting period of every fourth UE [TTI]                               네 번째 UE마다의 CQI 보고 주기 [TTI]
+ * \param allocations the RBG owners of every TTI, appended                                             모든 TTI의 RBG 소유자 (뒤에 추가됨)
+ * \return the run time [s]                                                                             실행 시간 [s]
+ */
+template <class Scheduler>
+double
+RunScheduler(Scheduler& scheduler,
+             const std::vector<uint8_t>& cqiPool,
+             uint16_t nUes,
+             uint16_t nRbgs,
+             uint32_t nTtis,
+             uint32_t cqiPeriod,
+             uint32_t slowCqiPeriod,
+             std::vector<uint16_t>& allocations)
+{
+    std::size_t nReports = cqiPool.size() / nRbgs;
+    allocations.resize(static_cast<std::size_t>(nTtis) * nRbgs);
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t tti = 0; tti < nTtis; ++tti)
+    {
+        for (uint16_t ue = 0; ue < nUes; ++ue)
+        {
+            if (ReportsCqi(ue, tti, cqiPeriod, slowCqiPeriod))
+            {
+                std::size_t report = (static_cast<std::size_t>(tti) * nUes + ue) % nReports;
+                scheduler.SetSubbandCqi(ue + 1, &cqiPool[report * nRbgs]);
+            }
+        }
+        scheduler.Schedule();
+        for (uint16_t rbg = 0; rbg < nRbgs; ++rbg)
+        {
+            allocations[static_cast<std::size_t>(tti) * nRbgs + rbg] = scheduler.GetRbgOwner(rbg);
+        }
+    }
+    std::chrono::duration<double> time = std::chrono::steady_clock::now() - start;
+    return time.count();
+}
+
+/**
+ * Run the cells of a batch for a number of TTIs, as RunScheduler() does for                            RunScheduler()가 한 셀에 대해 하는 것처럼 배치의 셀들을 여러 TTI 동안
+ * one cell.                                                                                            실행합니다.
+ *
+ * \param batch the batch, with its cells and UEs (RNTI 1..nUes) added                                  셀과 UE(RNTI 1..nUes)가 추가된 배치
+ * \param cqiPool the subband CQI reports, nRbgs values each                                            서브밴드 CQI 보고 (각각 nRbgs개 값)
+ * \param nUes the number of UEs per cell                                                               셀당 UE 수
+ * \param nRbgs the number of RBGs                                                                      RBG 수
+ * \param nTtis the number of TTIs                                                                      TTI 수
+ * \param cqiPeriod the CQI reporting period of the UEs [TTI]                                           UE들의 CQI 보고 주기 [TTI]
+ * \param slowCqiPeriod the CQI reporting period of every fourth UE [TTI]                               네 번째 UE마다의 CQI 보고 주기 [TTI]
+ * \param allocations the RBG owners of every TTI and cell, appended                                    모든 TTI와 셀의 RBG 소유자 (뒤에 추가됨)
+ * \return the run time [s]                                                                             실행 시간 [s]
+ */
+double
+RunCells(PfCellBatch& batch,
+         const std::vector<uint8_t>& cqiPool,
+         uint16_t nUes,
+         uint16_t nRbgs,
+         uint32_t nTtis,
+         uint32_t cqiPeriod,
+         uint32_t slowCqiPeriod,
+         std::vector<uint16_t>& allocations)
+{
+    std::size_t nCells = batch.GetNCells();
+    std::size_t nReports = cqiPool.size() / nRbgs;
+    allocations.resize(static_cast<std::size_t>(nTtis) * nCells * nRbgs);
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t tti = 0; tti < nTtis; ++tti)
+    {
+        for (std::size_t cell = 0; cell < nCells; ++cell)
+        {
+            for (uint16_t ue = 0; ue < nUes; ++ue)
+            {
+                if (ReportsCqi(ue, tti, cqiPeriod, slowCqiPeriod))
+                {
+                    std::size_t report = ((tti + cell) * nUes + ue) % nReports;
+                    batch.GetCell(cell).SetSubbandCqi(ue + 1, &cqiPool[report * nRbgs]);
+                }
+            }
+        }
+        batch.ScheduleAll();
+        for (std::size_t cell = 0; cell < nCells; ++cell)
+        {
+            for (uint16_t rbg = 0; rbg < nRbgs; ++rbg)
+            {
+                allocations[(tti * nCells + cell) * nRbgs + rbg] =
+                    batch.GetCell(cell).GetRbgOwner(rbg);
+            }
+        }
+    }
+    std::chrono::duration<double> time = std::chrono::steady_clock::now() - start;
+    return time.count();
+}
+
+/**
+ * Microbenchmark of the PF DL resource allocation: the map-based allocation of                         PF DL 자원 할당의 마이크로벤치마크: PfFfMacScheduler의 맵 기반 할당과
+ * PfFfMacScheduler against the flat-array PfRbgScheduler of                                            lena-pf-scheduler-kernel.h의 평면 배열 PfRbgScheduler를 셀당 UE 수별로
+ * lena-pf-scheduler-kernel.h, for each number of UEs per cell, with full                               비교합니다(전체 버퍼, 무작위 서브밴드 CQI). 두 스케줄러의 모든 TTI
+ * buffers and random subband CQIs. The RBG owners of every TTI and the final                           RBG 소유자와 최종 평균 처리량이 동일한지 검사합니다. 네 번째 UE마다
+ * averaged throughputs of the two schedulers are checked to be identical.                              CQI 타이머보다 드물게 보고하므로, 검사는 CQI 만료도 포함합니다.
+ * Every fourth UE reports less often than the CQI timer, so that the check
+ * covers the CQI expiry too.
+ *
+ * With nCells > 1, the TTI-batched scheduling of PfCellBatch                                           nCells > 1이면 lena-pf-cell-batch.h의 PfCellBatch를 사용한 TTI 배치
+ * (lena-pf-cell-batch.h) is also measured: nCells cells of cellUes UEs,                                스케줄링도 측정합니다: cellUes개 UE를 가진 nCells개 셀을 한 스레드와
+ * scheduled by one thread and by nThreads threads, with identical allocations.                         nThreads개 스레드로 스케줄링하며, 할당은 동일해야 합니다.
+ *
+ * ./ns3 run "lena-pf-scheduler-benchmark --nUes=10,50,100,500 --nRbs=100"
+ * ./ns3 run "lena-pf-scheduler-benchmark --nCells=64 --cellUes=20 --nThreads=4"
+ */
+int
+main(int argc, char* argv[])
+{
+    std::string nUesList = "10,50,100,200,500";                                                         // 셀당 UE 수 목록
+    uint16_t nRbs = 100;                                                                                // RB 수
+    uint32_t nTtis = 10000;                                                                             // 스케줄링할 TTI 수
+    uint32_t cqiPeriod = 2;                                                                             // CQI 보고 주기 [TTI]
+    uint32_t slowCqiPeriod = 1500;                                                                      // 네 번째 UE마다의 CQI 보고 주기 [TTI]
+    uint16_t cqiTimerThreshold = 1000;                                                                  // CQI 유효 기간 [TTI]
+    uint32_t nCells = 1;                                                                                // 배치로 스케줄링할 셀 수
+    uint16_t cellUes = 20;                                                                              // 배치의 셀당 UE 수
+    uint32_t nThreads = 2;                                                                              // 배치를 스케줄링할 스레드 수
+
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("nUes", "Comma-separated list of numbers of UEs per cell", nUesList);                  // 쉼표로 구분된 셀당 UE 수 목록
+    cmd.AddValue("nRbs", "Number of resource blocks", nRbs);                                            // RB 수
+    cmd.AddValue("nTtis", "Number of TTIs scheduled", nTtis);                                           // 스케줄링할 TTI 수
+    cmd.AddValue("cqiPeriod", "Subband CQI reporting period of each UE [TTI]", cqiPeriod);              // 각 UE의 서브밴드 CQI 보고 주기 [TTI]
+    cmd.AddValue("slowCqiPeriod",
+                 "Subband CQI reporting period of every fourth UE [TTI], longer than "              // 네 번째 UE마다의 서브밴드 CQI 보고 주기 [TTI]
+                 "the CQI timer so that its CQIs expire",
+                 slowCqiPeriod);
+    cmd.AddValue("cqiTimerThreshold",
+                 "Number of TTIs a CQI report is valid, as PfFfMacScheduler::CqiTimerThreshold",        // CQI 보고가 유효한 TTI 수
+                 cqiTimerThreshold);
+    cmd.AddValue("nCells", "Number of cells scheduled as a batch, 1 to skip", nCells);                  // 배치로 스케줄링할 셀 수 (1이면 생략)
+    cmd.AddValue("cellUes", "Number of UEs per cell of the batch", cellUes);                            // 배치의 셀당 UE 수
+    cmd.AddValue("nThreads", "Number of threads scheduling the batch", nThreads);                       // 배치를 스케줄링할 스레드 수
+    cmd.Parse(argc, argv);
+
+    NS_ABORT_MSG_IF(cqiPeriod == 0 || slowCqiPeriod == 0, "the CQI periods must be positive");
+
+    // RBG size of the type 0 allocation, as in PfFfMacScheduler                                        PfFfMacScheduler와 같은 유형 0 할당의 RBG 크기
+    uint16_t rbgSize = nRbs <= 10 ? 1 : (nRbs <= 26 ? 2 : (nRbs <= 63 ? 3 : 4));
+    uint16_t nRbgs = nRbs / rbgSize;
+
+    Ptr<LteAmc> amc = CreateObject<LteAmc>();
+    PfLinkTables tables;
+    tables.maxPrbs = nRbgs * rbgSize;
+    for (uint8_t cqi = 0; cqi <= 15; ++cqi)
+    {
+        tables.mcsFromCqi.push_back(amc->GetMcsFromCqi(cqi));
+    }
+    for (uint8_t mcs = 0; mcs <= 28; ++mcs)
+    {
+        for (uint16_t nPrbs = 0; nPrbs <= tables.maxPrbs; ++nPrbs)
+        {
+            tables.tbBits.push_back(nPrbs == 0 ? 0 : amc->GetDlTbSizeFromMcs(mcs, nPrbs));
+        }
+    }
+
+    // pool of subband CQI reports                                                                      서브밴드 CQI 보고 풀
+    Ptr<UniformRandomVariable> cqiRv = CreateObject<UniformRandomVariable>();
+    std::vector<uint8_t> cqiPool(1021 * nRbgs);
+    for (auto& cqi : cqiPool)
+    {
+        cqi = cqiRv->GetInteger(0, 15);
+    }
+
+    std::cout << "RBs " << nRbs << ", RBGs " << nRbgs << ", TTIs " << nTtis << ", CQI period "
+              << cqiPeriod << " (" << slowCqiPeriod << " for every fourth UE), CQI timer "
+              << cqiTimerThreshold << std::endl;
+    std::cout << std::setw(6) << "UEs" << std::setw(18) << "map [TTI/s]" << std::setw(18)
+              << "flat [TTI/s]" << std::setw(10) << "speedup" << "  results" << std::endl;
+
+    bool allIdentical = true;
+    std::istringstream listStream(nUesList);
+    std::string token;
+    while (std::getline(listStream, token, ','))
+    {
+        uint16_t nUes = std::stoi(token);
+        NS_ABORT_MSG_IF(nUes == 0, "at least one UE is needed");
+
+        MapPfScheduler mapScheduler(amc, nRbgs, rbgSize);
+        PfRbgScheduler flatScheduler(tables, nRbgs, rbgSize);
+        mapScheduler.SetCqiTimerThreshold(cqiTimerThreshold);
+        flatScheduler.SetCqiTimerThreshold(cqiTimerThreshold);
+        for (uint16_t rnti = 1; rnti <= nUes; ++rnti)
+        {
+            mapScheduler.AddUe(rnti);
+            flatScheduler.AddUe(rnti);
+        }
+
+        std::vector<uint16_t> mapAllocations;
+        std::vector<uint16_t> flatAllocations;
+        double mapTime = RunScheduler(mapScheduler,
+                                      cqiPool,
+                                      nUes,
+                                      nRbgs,
+                                      nTtis,
+                                      cqiPeriod,
+                                      slowCqiPeriod,
+                                      mapAllocations);
+        double flatTime = RunScheduler(flatScheduler,
+                                       cqiPool,
+                                       nUes,
+                                       nRbgs,
+                                       nTtis,
+                                       cqiPeriod,
+                                       slowCqiPeriod,
+                                       flatAllocations);
+
+        bool identical = (mapAllocations == flatAllocations);
+        for (uint16_t rnti = 1; rnti <= nUes; ++rnti)
+        {
+            identical = identical && (mapScheduler.GetAveragedThroughput(rnti) ==
+                                      flatScheduler.GetAveragedThroughput(rnti));
+        }
+        allIdentical = allIdentical && identical;
+
+        std::cout << std::fixed << std::setprecision(0) << std::setw(6) << nUes << std::setw(18)
+                  << nTtis / mapTime << std::setw(18) << nTtis / flatTime << std::setprecision(2)
+                  << std::setw(10) << mapTime / flatTime << "  "
+                  << (identical ? "identical" : "DIFFERENT") << std::endl;
+    }
+
+    NS_ABORT_MSG_IF(!allIdentical, "the flat PF allocation differs from the map-based one");
+
+    if (nCells > 1)
+    {
+        NS_ABORT_MSG_IF(cellUes == 0, "at least one UE per cell is needed");
+        std::vector<uint16_t> allocations[2];
+        double time[2];
+        uint32_t threads[2] = {1, nThreads};
+        for (int i = 0; i < 2; ++i)
+        {
+            PfCellBatch batch(tables, threads[i]);
+            for (uint32_t cell = 0; cell < nCells; ++cell)
+            {
+                PfRbgScheduler& scheduler = batch.AddCell(nRbgs, rbgSize);
+                scheduler.SetCqiTimerThreshold(cqiTimerThreshold);
+                for (uint16_t rnti = 1; rnti <= cellUes; ++rnti)
+                {
+                    scheduler.AddUe(rnti);
+                }
+            }
+            time[i] = RunCells(batch,
+                               cqiPool,
+                               cellUes,
+                               nRbgs,
+                               nTtis,
+                               cqiPeriod,
+                               slowCqiPeriod,
+                               allocations[i]);
+        }
+        bool identical = (allocations[0] == allocations[1]);
+        std::cout << "batch of " << nCells << " cells, " << cellUes << " UEs each: "
+                  << std::setprecision(0) << nTtis / time[0] << " TTI/s with 1 thread, "
+                  << nTtis / time[1] << " TTI/s with " << nThreads << " threads, results "
+                  << (identical ? "identical" : "DIFFERENT") << std::endl;
+        NS_ABORT_MSG_IF(!identical, "the batch allocation depends on the number of threads");
+    }
+    return 0;
+}
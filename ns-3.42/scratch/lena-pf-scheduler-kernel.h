@@ -0,0 +1,238 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef LENA_PF_SCHEDULER_KERNEL_H
+#define LENA_PF_SCHEDULER_KERNEL_H
+
+#include <ns3/abort.h>
+#include <ns3/assert.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * Tables of the link adaptation used by the PF kernel, filled once from                                PF 커널이 사용하는 링크 적응 테이블로, LteAmc에서 한 번 채웁니다
+ * LteAmc (GetMcsFromCqi() and GetDlTbSizeFromMcs()), so that no AMC call is                            (GetMcsFromCqi() 및 GetDlTbSizeFromMcs()). 따라서 TTI마다 AMC 호출이
+ * done per TTI.                                                                                        없습니다.
+ */
+struct PfLinkTables
+{
+    uint16_t maxPrbs{0};             ///< highest number of PRBs of the TB size table
+    std::vector<uint8_t> mcsFromCqi; ///< MCS for each CQI (0..15)
+    std::vector<uint32_t> tbBits;    ///< TB size [bits] at [mcs * (maxPrbs + 1) + nPrbs]
+
+    /**
+     * \param mcs the MCS                                                                               MCS
+     * \param nPrbs the number of PRBs                                                                  PRB 수
+     * \return the TB size [bits]                                                                       TB 크기 [비트]
+     */
+    uint32_t GetTbBits(uint8_t mcs, uint16_t nPrbs) const
+    {
+        NS_ASSERT(nPrbs <= maxPrbs);
+        return tbBits[mcs * (maxPrbs + 1) + nPrbs];
+    }
+};
+
+/**
+ * DL resource allocation of PfFfMacScheduler::DoSchedDlTriggerReq() on flat                            PfFfMacScheduler::DoSchedDlTriggerReq()의 DL 자원 할당을 평면 배열로
+ * arrays, without heap allocations per TTI.                                                            구현하여 TTI마다 힙 할당을 하지 않습니다.
+ *
+ * PfFfMacScheduler keeps the per-RNTI state in std::map containers, copies                             PfFfMacScheduler는 RNTI별 상태를 std::map에 두고, RBG와 UE마다
+ * the subband CQI vector of every UE for every RBG and builds the allocation                           서브밴드 CQI 벡터를 복사하며, TTI마다 할당 맵과 RBG 맵을 새로
+ * and RBG maps anew every TTI. Here the UEs are dense slots, sorted by RNTI,                           만듭니다. 여기서는 UE가 RNTI 순으로 정렬된 조밀한 슬롯이며, 상태는
+ * the state is a structure of arrays (averaged throughput, subband CQI) and                            배열 구조(평균 처리량, 서브밴드 CQI)이고, RBG 소유자와 UE별 할당
+ * the RBG owners and per-UE allocation counters are scratch buffers sized when                         카운터는 UE 추가 시 크기가 정해지는 작업 버퍼입니다. 할당은 같은
+ * the UEs are added. The allocation follows the same steps, in the same order:                         순서로 같은 단계를 따릅니다: RBG마다 달성 가능 속도 / 평균 처리량이
+ * for each RBG the UE with the highest achievable rate / averaged throughput                           가장 높은 UE가 선택되며(동률이면 가장 낮은 RNTI), 각 UE는 할당된
+ * wins it (lowest RNTI on ties), each UE transmits a TB at the MCS of the worst                        RBG 중 최악의 CQI에 해당하는 MCS로 TB를 전송하고, 모든 UE의 평균
+ * CQI among its RBGs, and the averaged throughput of every UE is updated with                          처리량은 시간 창 지수 이동 평균으로 갱신됩니다. 따라서 결정은
+ * the time window moving average; hence the decisions are identical.                                   동일합니다.
+ *
+ * The CQI expiry (CqiTimerThreshold) uses generation counters instead of the                           CQI 만료(CqiTimerThreshold)는 TTI마다 모든 UE의 타이머를 감소시키는
+ * per-TTI decrement of the timer of every UE: a report stores the TTI at which                         대신 세대 카운터를 사용합니다. 보고 시 CQI가 만료되는 TTI를 저장하고,
+ * it expires, and an expired CQI is read as 1, the value PfFfMacScheduler uses                         만료된 CQI는 PfFfMacScheduler가 맵에서 지운 뒤 사용하는 값인 1로
+ * once it erased it from its maps. Idle UEs cost nothing.                                              읽힙니다. 유휴 UE에는 비용이 들지 않습니다.
+ *
+ * The kernel covers the full-buffer, single-layer case: the RLC buffer, HARQ                           이 커널은 전체 버퍼, 단일 계층 경우를 다룹니다. RLC 버퍼, HARQ
+ * retransmissions and DCI building stay in the scheduler.                                              재전송, DCI 구성은 스케줄러에 남습니다.
+ */
+class PfRbgScheduler
+{
+  public:
+    /**
+     * \param tables the link adaptation tables                                                         링크 적응 테이블
+     * \param nRbgs the number of RBGs                                                                  RBG 수
+     * \param rbgSize the number of PRBs per RBG                                                        RBG당 PRB 수
+     * \param timeWindow the time window of the averaged throughput [TTI]                               평균 처리량의 시간 창 [TTI]
+     */
+    PfRbgScheduler(const PfLinkTables& tables,
+                   uint16_t nRbgs,
+                   uint16_t rbgSize,
+                   double timeWindow = 99.0)
+        : m_tables(tables),
+          m_nRbgs(nRbgs),
+          m_rbgSize(rbgSize),
+          m_timeWindow(timeWindow),
+          m_rbgOwner(nRbgs, NO_UE)
+    {
+        NS_ABORT_MSG_IF(nRbgs * rbgSize > tables.maxPrbs, "the TB size table is too small");
+    }
+
+    /// Value of GetRbgOwner() for an RBG allocated to no UE                                            어떤 UE에도 할당되지 않은 RBG에 대한 GetRbgOwner() 값
+    static constexpr uint16_t NO_UE = std::numeric_limits<uint16_t>::max();
+
+    /**
+     * \param threshold the number of TTIs a CQI report is valid, as the                                CQI 보고가 유효한 TTI 수 (PfFfMacScheduler의
+     *                  CqiTimerThreshold attribute of PfFfMacScheduler                                 CqiTimerThreshold 속성과 같음)
+     */
+    void SetCqiTimerThreshold(uint16_t threshold)
+    {
+        m_cqiTimerThreshold = threshold;
+    }
+
+    /**
+     * Add a UE, with a subband CQI of 1 as PfFfMacScheduler assumes before the                         UE를 추가합니다. PfFfMacScheduler가 첫 보고 전에 가정하는 것처럼
+     * first report. Allocates, to be called at setup.                                                  서브밴드 CQI는 1입니다. 할당이 일어나므로 설정 시에 호출해야 합니다.
+     *
+     * \param rnti the RNTI                                                                             RNTI
+     */
+    void AddUe(uint16_t rnti)
+    {
+        auto pos = std::lower_bound(m_rnti.begin(), m_rnti.end(), rnti);
+        NS_ABORT_MSG_IF(pos != m_rnti.end() && *pos == rnti, "RNTI " << rnti << " already added");
+        std::size_t slot = pos - m_rnti.begin();
+        m_rnti.insert(pos, rnti);
+        m_averagedThroughput.insert(m_averagedThroughput.begin() + slot, 1.0);
+        m_sbCqi.insert(m_sbCqi.begin() + slot * m_nRbgs, m_nRbgs, 1);
+        m_cqiExpiry.insert(m_cqiExpiry.begin() + slot, 0);
+        m_nAllocated.push_back(0);
+        m_worstCqi.push_back(0);
+        m_slotOfRnti.resize(std::max<std::size_t>(m_slotOfRnti.size(), rnti + 1), NO_UE);
+        for (std::size_t s = slot; s < m_rnti.size(); ++s)
+        {
+            m_slotOfRnti[m_rnti[s]] = s;
+        }
+    }
+
+    /**
+     * Store the subband CQI reported by a UE.                                                          UE가 보고한 서브밴드 CQI를 저장합니다.
+     *
+     * \param rnti the RNTI                                                                             RNTI
+     * \param sbCqi the CQI of each RBG, nRbgs values                                                   각 RBG의 CQI (nRbgs개 값)
+     */
+    void SetSubbandCqi(uint16_t rnti, const uint8_t* sbCqi)
+    {
+        NS_ASSERT(rnti < m_slotOfRnti.size() && m_slotOfRnti[rnti] != NO_UE);
+        uint16_t slot = m_slotOfRnti[rnti];
+        std::copy(sbCqi, sbCqi + m_nRbgs, m_sbCqi.begin() + slot * m_nRbgs);
+        m_cqiExpiry[slot] = m_tti + m_cqiTimerThreshold;
+    }
+
+    /// Allocate the RBGs of one TTI and update the averaged throughputs                                한 TTI의 RBG를 할당하고 평균 처리량을 갱신합니다.
+    void Schedule()
+    {
+        const std::size_t nUes = m_rnti.size();
+        std::fill(m_nAllocated.begin(), m_nAllocated.end(), 0);
+        std::fill(m_worstCqi.begin(), m_worstCqi.end(), UINT8_MAX);
+        for (uint16_t rbg = 0; rbg < m_nRbgs; ++rbg)
+        {
+            uint16_t best = NO_UE;
+            uint8_t bestCqi = 0;
+            double bestMetric = 0.0;
+            const uint8_t* sbCqi = m_sbCqi.data() + rbg;
+            for (std::size_t ue = 0; ue < nUes; ++ue, sbCqi += m_nRbgs)
+            {
+                uint8_t cqi = m_tti < m_cqiExpiry[ue] ? *sbCqi : 1;
+                if (cqi == 0)
+                {
+                    continue;
+                }
+                uint32_t tbBits = m_tables.GetTbBits(m_tables.mcsFromCqi[cqi], m_rbgSize);
+                double achievableRate = (tbBits / 8) / 0.001;
+                double metric = achievableRate / m_averagedThroughput[ue];
+                if (metric > bestMetric)
+                {
+                    bestMetric = metric;
+                    bestCqi = cqi;
+                    best = ue;
+                }
+            }
+            m_rbgOwner[rbg] = best;
+            if (best != NO_UE)
+            {
+                ++m_nAllocated[best];
+                m_worstCqi[best] = std::min(m_worstCqi[best], bestCqi);
+            }
+        }
+
+        double alpha = 1.0 / m_timeWindow;
+        for (std::size_t ue = 0; ue < nUes; ++ue)
+        {
+            uint32_t bytes = 0;
+            if (m_nAllocated[ue] > 0)
+            {
+                uint8_t mcs = m_tables.mcsFromCqi[m_worstCqi[ue]];
+                bytes = m_tables.GetTbBits(mcs, m_nAllocated[ue] * m_rbgSize) / 8;
+            }
+            m_averagedThroughput[ue] =
+                ((1.0 - alpha) * m_averagedThroughput[ue]) + (alpha * (bytes / 0.001));
+        }
+        ++m_tti;
+    }
+
+    /**
+     * \param rbg the RBG                                                                               RBG
+     * \return the RNTI the RBG was allocated to in the last TTI, or NO_UE                              마지막 TTI에서 RBG가 할당된 RNTI, 또는 NO_UE
+     */
+    uint16_t GetRbgOwner(uint16_t rbg) const
+    {
+        return m_rbgOwner[rbg] == NO_UE ? NO_UE : m_rnti[m_rbgOwner[rbg]];
+    }
+
+    /**
+     * \param rnti the RNTI                                                                             RNTI
+     * \return the averaged throughput of the UE [byte/s]                                               UE의 평균 처리량 [byte/s]
+     */
+    double GetAveragedThroughput(uint16_t rnti) const
+    {
+        NS_ASSERT(rnti < m_slotOfRnti.size() && m_slotOfRnti[rnti] != NO_UE);
+        return m_averagedThroughput[m_slotOfRnti[rnti]];
+    }
+
+  private:
+    const PfLinkTables& m_tables;             ///< link adaptation tables
+    uint16_t m_nRbgs;                         ///< number of RBGs
+    uint16_t m_rbgSize;                       ///< PRBs per RBG
+    double m_timeWindow;                      ///< time window of the averaged throughput [TTI]
+    std::vector<uint16_t> m_rnti;             ///< RNTI of each slot, in increasing order
+    std::vector<uint16_t> m_slotOfRnti;       ///< slot of each RNTI, NO_UE if none
+    std::vector<double> m_averagedThroughput; ///< averaged throughput of each slot [byte/s]
+    uint16_t m_cqiTimerThreshold{1000};       ///< TTIs a CQI report is valid
+    uint64_t m_tti{0};                        ///< TTIs scheduled so far
+    std::vector<uint64_t> m_cqiExpiry;        ///< TTI at which the CQI of each slot expires
+    std::vector<uint8_t> m_sbCqi;             ///< subband CQI at [slot * nRbgs + rbg]
+    std::vector<uint16_t> m_rbgOwner;         ///< slot of the owner of each RBG, scratch
+    std::vector<uint16_t> m_nAllocated;       ///< RBGs allocated to each slot, scratch
+    std::vector<uint8_t> m_worstCqi;          ///< worst CQI of the RBGs of each slot, scratch
+};
+
+} // namespace ns3
+
+#endif // LENA_PF_SCHEDULER_KERNEL_H
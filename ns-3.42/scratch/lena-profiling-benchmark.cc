@@ -0,0 +1,288 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "lena-profiling-scenario.h"
+#include "lena-subframe-calendar-scheduler.h"
+#include "lena-subsystem-profiler.h"
+
+#include "ns3/config-store.h"
+#include "ns3/core-module.h"
+#include "ns3/lte-module.h"
+#include "ns3/network-module.h"
+
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE("LenaProfilingBenchmark");
+
+/**
+ * Parse a comma-separated list.                                                                        쉼표로 구분된 목록을 파싱합니다.
+ *
+ * \param list the list                                                                                 목록
+ * \return the values                                                                                   값들
+ */
+template <class T>
+std::vector<T>
+ParseList(const std::string& list)
+{
+    std::vector<T> values;
+    std::istringstream listStream(list);
+    std::string token;
+    while (std::getline(listStream, token, ','))
+    {
+        std::istringstream tokenStream(token);
+        T value;
+        tokenStream >> value;
+        NS_ABORT_MSG_IF(tokenStream.fail(), "invalid value \"" << token << "\" in " << list);
+        values.push_back(value);
+    }
+    NS_ABORT_MSG_IF(values.empty(), "empty list");
+    return values;
+}
+
+/**
+ * Run the lena-profiling scenario once and measure its cost.                                           lena-profiling 시나리오를 한 번 실행하고 비용을 측정합니다.
+ *
+ * \param nEnbPerFloor the number of eNBs per floor                                                     층당 eNB 수
+ * \param nUe the number of UEs per eNB                                                                 eNB당 UE 수
+ * \param nFloors the number of floors, 0 for the Friis propagation model                               층 수, Friis 전파 모델의 경우 0
+ * \param simTime the simulation time [s]                                                               시뮬레이션 시간 [s]
+ * \param traces whether the LTE traces are enabled, as in lena-profiling                               lena-profiling처럼 LTE 트레이스를 활성화할지 여부
+ * \param scheduler the TypeId name of the event scheduler                                              이벤트 스케줄러의 TypeId 이름
+ * \return the measurements, as the members of a JSON object                                            JSON 객체의 멤버로 표현한 측정값
+ */
+std::string
+RunPoint(uint32_t nEnbPerFloor,
+         uint32_t nUe,
+         uint32_t nFloors,
+         double simTime,
+         bool traces,
+         const std::string& scheduler)
+{
+    typedef std::chrono::steady_clock Clock;
+    ObjectFactory profilingScheduler("ns3::EventProfilingScheduler");
+    profilingScheduler.Set("Scheduler", TypeIdValue(TypeId::LookupByName(scheduler)));
+    Simulator::SetScheduler(profilingScheduler);
+
+    Clock::time_point setupStart = Clock::now();
+    Ptr<LteHelper> lteHelper = BuildProfilingScenario(nEnbPerFloor, nUe, nFloors);
+    NetDeviceContainer enbDevs;
+    for (auto it = NodeList::Begin(); it != NodeList::End(); ++it)
+    {
+        for (uint32_t j = 0; j < (*it)->GetNDevices(); j++)
+        {
+            if ((*it)->GetDevice(j)->GetObject<LteEnbNetDevice>())
+            {
+                enbDevs.Add((*it)->GetDevice(j));
+            }
+        }
+    }
+    std::vector<std::unique_ptr<TimedFfMacSchedSapProvider>> providers;
+    InstrumentSchedulers(enbDevs, providers);
+    InstrumentPathloss(lteHelper->GetDownlinkSpectrumChannel());
+    InstrumentPathloss(lteHelper->GetUplinkSpectrumChannel());
+    Simulator::Stop(Seconds(simTime));
+    if (traces)
+    {
+        lteHelper->EnableTraces();
+    }
+    std::chrono::duration<double> setupTime = Clock::now() - setupStart;
+
+    Clock::time_point runStart = Clock::now();
+    Simulator::Run();
+    SubsystemProfile::Get().StartEvent(nullptr);
+    std::chrono::duration<double> runTime = Clock::now() - runStart;
+    uint64_t events = Simulator::GetEventCount();
+    Simulator::Destroy();
+
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+#ifdef __APPLE__
+    uint64_t peakRssKiB = usage.ru_maxrss / 1024;                                                   // macOS는 바이트 단위로 보고합니다
+#else
+    uint64_t peakRssKiB = usage.ru_maxrss;
+#endif
+
+    const SubsystemProfile& profile = SubsystemProfile::Get();
+    std::ostringstream json;
+    json << "\"nEnb\": " << nEnbPerFloor << ", \"nUe\": " << nUe << ", \"nFloors\": " << nFloors
+         << ", \"simTime\": " << simTime << ", \"scheduler\": \"" << scheduler
+         << "\", \"setupTime\": " << setupTime.count()
+         << ", \"wallTime\": " << runTime.count() << ", \"events\": " << events
+         << ", \"eventsPerSecond\": " << events / runTime.count()
+         << ", \"peakRssKiB\": " << peakRssKiB << ", \"eventTime\": {";
+    for (uint32_t s = 0; s < SubsystemProfile::NUM_SUBSYSTEMS; s++)
+    {
+        auto subsystem = static_cast<SubsystemProfile::Subsystem>(s);
+        json << (s > 0 ? ", " : "") << "\"" << SubsystemProfile::GetName(subsystem)
+             << "\": " << profile.GetEventTime(subsystem);
+    }
+    json << "}, \"schedulerTime\": " << profile.GetSchedulerTime()
+         << ", \"pathlossTime\": " << profile.GetPathlossTime();
+    return json.str();
+}
+
+/**
+ * Run a point in a child process of its own, so that its peak RSS and simulator                        지점을 별도의 자식 프로세스에서 실행하므로, 최대 RSS와 시뮬레이터 상태는
+ * state do not depend on the other points (see RunPoint()).                                            다른 지점과 독립적입니다 (RunPoint() 참조).
+ *
+ * \param nEnbPerFloor the number of eNBs per floor                                                     층당 eNB 수
+ * \param nUe the number of UEs per eNB                                                                 eNB당 UE 수
+ * \param nFloors the number of floors, 0 for the Friis propagation model                               층 수, Friis 전파 모델의 경우 0
+ * \param simTime the simulation time [s]                                                               시뮬레이션 시간 [s]
+ * \param traces whether the LTE traces are enabled, as in lena-profiling                               lena-profiling처럼 LTE 트레이스를 활성화할지 여부
+ * \param scheduler the TypeId name of the event scheduler                                              이벤트 스케줄러의 TypeId 이름
+ * \return the measurements, or the reason of the failure of the child process                         측정값, 또는 자식 프로세스가 실패한 이유
+ */
+std::string
+RunPointInChild(uint32_t nEnbPerFloor,
+                uint32_t nUe,
+                uint32_t nFloors,
+                double simTime,
+                bool traces,
+                const std::string& scheduler)
+{
+    int fds[2];
+    NS_ABORT_MSG_IF(pipe(fds) != 0, "Can't create pipe");
+    std::cout.flush();
+    pid_t pid = fork();
+    NS_ABORT_MSG_IF(pid < 0, "Can't fork");
+    if (pid == 0)
+    {
+        close(fds[0]);
+        std::string result = RunPoint(nEnbPerFloor, nUe, nFloors, simTime, traces, scheduler);
+        bool written = write(fds[1], result.data(), result.size()) ==
+                       static_cast<ssize_t>(result.size());
+        close(fds[1]);
+        _exit(written ? 0 : 1);
+    }
+
+    close(fds[1]);
+    std::string result;
+    char buffer[4096];
+    ssize_t n;
+    while ((n = read(fds[0], buffer, sizeof(buffer))) > 0)
+    {
+        result.append(buffer, n);
+    }
+    close(fds[0]);
+    int status;
+    waitpid(pid, &status, 0);
+    if (!WIFEXITED(status) || WEXITSTATUS(status) != 0)
+    {
+        // keep the point in the output, with the reason of the failure                                 실패한 지점도 실패 이유와 함께 출력에 남깁니다
+        std::ostringstream failure;
+        failure << "\"nEnb\": " << nEnbPerFloor << ", \"nUe\": " << nUe
+                << ", \"nFloors\": " << nFloors << ", \"simTime\": " << simTime
+                << ", \"scheduler\": \"" << scheduler << "\", \"error\": \""
+                << (WIFEXITED(status) ? "exit status " : "signal ")
+                << (WIFEXITED(status) ? WEXITSTATUS(status) : WTERMSIG(status)) << "\"";
+        result = failure.str();
+    }
+    return result;
+}
+
+/**
+ * Scaling benchmark of the lena-profiling scenario.                                                    lena-profiling 시나리오의 확장성 벤치마크
+ *
+ * Every combination of the nEnb, nUe, nFloors and simTime lists is simulated in                        nEnb, nUe, nFloors, simTime 목록의 모든 조합을 별도의 자식 프로세스에서
+ * a child process of its own, so that the peak RSS and the simulator state of a                        시뮬레이션하므로, 각 지점의 최대 RSS와 시뮬레이터 상태는 다른 지점과
+ * point do not depend on the others. For each point, the JSON output has the                           독립적입니다. 각 지점에 대해 JSON 출력은 설정 시간과 실행 시간 [s],
+ * setup and run (wallTime) times [s], the events processed, the events per                             처리된 이벤트 수, 실행 시간 1초당 이벤트 수, 최대 RSS [KiB], 그리고
+ * second of run time, the peak RSS [KiB] and the time per subsystem [s]: the                           서브시스템별 시간 [s]을 가집니다: 이벤트가 호출하는 계층별 이벤트 시간
+ * event time per layer the events call (eventTime), and the time spent in the                          (eventTime), MAC 스케줄러(schedulerTime)와 경로 손실 모델(pathlossTime)에서
+ * MAC schedulers (schedulerTime) and pathloss models (pathlossTime), which is                          사용한 시간이며, 후자는 MAC 및 PHY 이벤트 시간에도 포함됩니다
+ * also part of the MAC and PHY event time (see SubsystemProfile).                                      (SubsystemProfile 참조).
+ *
+ * Each point is run with every event scheduler of the scheduler list; as the                           각 지점은 scheduler 목록의 모든 이벤트 스케줄러로 실행합니다. 이벤트 시간
+ * event time profiling costs the same with all of them, the wallTime of the                            프로파일링 비용은 모든 스케줄러에서 같으므로, 지점의 wallTime을 비교하면
+ * point compares the schedulers, e.g. at 1k and 10k UEs:                                               스케줄러를 비교할 수 있습니다. 예: 1천 및 1만 UE에서:
+ *
+ * ./ns3 run "lena-profiling-benchmark --nEnb=1,4,16 --nUe=1,10 --nFloors=0,2"
+ * ./ns3 run "lena-profiling-benchmark --nEnb=10,100 --nUe=100 --nFloors=0
+ *     --scheduler=ns3::MapScheduler,ns3::HeapScheduler,ns3::SubframeCalendarScheduler"
+ */
+int
+main(int argc, char* argv[])
+{
+    std::string nEnbList = "1,4";                                                                   // 층당 eNB 수 목록
+    std::string nUeList = "1,10";                                                                   // eNB당 UE 수 목록
+    std::string nFloorsList = "0,1";                                                                // 층 수 목록
+    std::string simTimeList = "1.0";                                                                // 시뮬레이션 시간 목록 [s]
+    bool traces = true;                                                                             // LTE 트레이스 활성화 여부
+    std::string schedulerList = "ns3::MapScheduler";                                                // 이벤트 스케줄러 목록
+    std::string output = "lena-profiling-benchmark.json";                                           // JSON 출력 파일 이름
+
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("nEnb", "Comma-separated list of numbers of eNodeBs per floor", nEnbList);         // 쉼표로 구분된 층당 eNodeB 수 목록
+    cmd.AddValue("nUe", "Comma-separated list of numbers of UEs per eNodeB", nUeList);              // 쉼표로 구분된 eNodeB당 UE 수 목록
+    cmd.AddValue("nFloors",
+                 "Comma-separated list of numbers of floors, 0 for Friis propagation model",        // 쉼표로 구분된 층 수 목록, Friis 전파 모델의 경우 0
+                 nFloorsList);
+    cmd.AddValue("simTime",
+                 "Comma-separated list of simulation durations (in seconds)",                       // 쉼표로 구분된 시뮬레이션 시간 목록 (초 단위)
+                 simTimeList);
+    cmd.AddValue("traces", "Enable the LTE traces, as lena-profiling does", traces);                // lena-profiling처럼 LTE 트레이스 활성화
+    cmd.AddValue("scheduler",
+                 "Comma-separated list of event schedulers, e.g. ns3::SubframeCalendarScheduler",   // 쉼표로 구분된 이벤트 스케줄러 목록
+                 schedulerList);
+    cmd.AddValue("output", "Name of the JSON output file", output);                                 // JSON 출력 파일 이름
+    cmd.Parse(argc, argv);
+
+    ConfigStore inputConfig;
+    inputConfig.ConfigureDefaults();
+
+    // parse again so you can override default values from the command line                             명령줄에서 기본값을 재설정할 수 있도록 다시 파싱합니다.
+    cmd.Parse(argc, argv);
+
+    std::ofstream outFile(output, std::ios_base::out | std::ios_base::trunc);
+    NS_ABORT_MSG_IF(!outFile.is_open(), "Can't open file " << output);
+    outFile << "{\n  \"benchmark\": \"lena-profiling\",\n  \"results\": [";
+
+    bool first = true;
+    for (double simTime : ParseList<double>(simTimeList))
+    {
+        for (uint32_t nFloors : ParseList<uint32_t>(nFloorsList))
+        {
+            for (uint32_t nEnb : ParseList<uint32_t>(nEnbList))
+            {
+                for (uint32_t nUe : ParseList<uint32_t>(nUeList))
+                {
+                    for (const std::string& scheduler : ParseList<std::string>(schedulerList))
+                    {
+                        std::string result =
+                            RunPointInChild(nEnb, nUe, nFloors, simTime, traces, scheduler);
+                        std::cout << "{" << result << "}" << std::endl;
+                        outFile << (first ? "\n" : ",\n") << "    {" << result << "}";
+                        first = false;
+                    }
+                }
+            }
+        }
+    }
+    outFile << "\n  ]\n}\n";
+    return 0;
+}
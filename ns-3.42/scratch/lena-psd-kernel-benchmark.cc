@@ -0,0 +1,128 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "lena-psd-kernel.h"
+
+#include "ns3/core-module.h"
+#include "ns3/lte-module.h"
+#include "ns3/spectrum-module.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE("LenaPsdKernelBenchmark");
+
+/**
+ * Microbenchmark of the per-RB SINR computation done for every REM point and                           모든 REM 지점과 간섭 청크마다 수행되는 RB별 SINR 계산의 마이크로벤치마크
+ * interference chunk: the received PSDs of all the eNBs are summed up and the                          모든 eNB의 수신 PSD를 합산한 뒤 원하는 신호에 대한 SINR을 계산합니다.
+ * SINR of the wanted signal is computed. The SpectrumValue operators used                              현재 사용되는 SpectrumValue 연산자 루프와 lena-psd-kernel.h의 커널을
+ * today are compared against the kernels of lena-psd-kernel.h, and the two                             비교하고, 두 결과가 비트 단위로 동일한지 검사합니다.
+ * results are checked to be bit-for-bit identical.
+ *
+ * ./ns3 run "lena-psd-kernel-benchmark --nEnbs=57 --nRbs=100 --nPoints=100000"
+ */
+int
+main(int argc, char* argv[])
+{
+    uint32_t nEnbs = 57;                                                                                // 간섭을 주는 eNB 수
+    uint16_t nRbs = 100;                                                                                // RB 수
+    uint32_t nPoints = 100000;                                                                          // 계산할 지점 수
+    uint32_t earfcn = 100;                                                                              // DL EARFCN
+    double noiseFigure = 9.0;                                                                           // 잡음 지수 [dB]
+
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("nEnbs", "Number of eNBs whose PSD is summed up at each point", nEnbs);                // 각 지점에서 합산되는 eNB PSD 수
+    cmd.AddValue("nRbs", "Number of resource blocks", nRbs);                                            // RB 수
+    cmd.AddValue("nPoints", "Number of points (REM points or chunks) evaluated", nPoints);              // 평가할 지점(REM 지점 또는 청크) 수
+    cmd.Parse(argc, argv);
+
+    NS_ABORT_MSG_IF(nEnbs == 0, "at least one eNB is needed");
+
+    Ptr<SpectrumModel> sm = LteSpectrumValueHelper::GetSpectrumModel(earfcn, nRbs);
+    Ptr<SpectrumValue> noise =
+        LteSpectrumValueHelper::CreateNoisePowerSpectralDensity(earfcn, nRbs, noiseFigure);
+
+    // received PSDs, one per eNB, with random per-RB values                                            eNB마다 하나씩, RB별 무작위 값을 갖는 수신 PSD
+    Ptr<UniformRandomVariable> power = CreateObject<UniformRandomVariable>();
+    power->SetAttribute("Min", DoubleValue(1e-21));
+    power->SetAttribute("Max", DoubleValue(1e-16));
+    std::vector<Ptr<SpectrumValue>> rxPsds;
+    for (uint32_t i = 0; i < nEnbs; ++i)
+    {
+        Ptr<SpectrumValue> psd = Create<SpectrumValue>(sm);
+        for (auto it = psd->ValuesBegin(); it != psd->ValuesEnd(); ++it)
+        {
+            *it = power->GetValue();
+        }
+        rxPsds.push_back(psd);
+    }
+
+    // SpectrumValue operators, as in the REM helper and LteInterference                                REM 헬퍼와 LteInterference에서와 같은 SpectrumValue 연산자
+    double checksum = 0;
+    SpectrumValue lastSinr(sm);
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t p = 0; p < nPoints; ++p)
+    {
+        SpectrumValue all(sm);
+        for (const auto& psd : rxPsds)
+        {
+            all += *psd;
+        }
+        const SpectrumValue& rx = *rxPsds[p % nEnbs];
+        SpectrumValue sinr = rx / (all - rx + (*noise));
+        checksum += sinr[0];
+        lastSinr = sinr;
+    }
+    std::chrono::duration<double> operatorTime = std::chrono::steady_clock::now() - start;
+
+    // kernel path, with the buffers allocated once                                                     버퍼를 한 번만 할당하는 커널 경로
+    double kernelChecksum = 0;
+    SpectrumValue all(sm);
+    SpectrumValue sinr(sm);
+    start = std::chrono::steady_clock::now();
+    for (uint32_t p = 0; p < nPoints; ++p)
+    {
+        std::fill(all.ValuesBegin(), all.ValuesEnd(), 0.0);
+        for (const auto& psd : rxPsds)
+        {
+            psdkernel::Accumulate(all, *psd);
+        }
+        psdkernel::Sinr(sinr, *rxPsds[p % nEnbs], all, *noise);
+        kernelChecksum += sinr[0];
+    }
+    std::chrono::duration<double> kernelTime = std::chrono::steady_clock::now() - start;
+
+    bool identical = (checksum == kernelChecksum) && std::equal(sinr.ConstValuesBegin(),
+                                                                sinr.ConstValuesEnd(),
+                                                                lastSinr.ConstValuesBegin());
+
+    std::cout << "eNBs " << nEnbs << ", RBs " << nRbs << ", points " << nPoints
+              << (psdkernel::HasAvx2() ? ", AVX2 kernel" : ", scalar kernel") << std::endl;
+    std::cout << std::fixed << std::setprecision(0);
+    std::cout << "SpectrumValue operators: " << nPoints / operatorTime.count() << " points/s"
+              << std::endl;
+    std::cout << "PSD kernel:              " << nPoints / kernelTime.count() << " points/s"
+              << std::endl;
+    std::cout << std::setprecision(2) << "speedup: " << operatorTime.count() / kernelTime.count()
+              << ", results " << (identical ? "identical" : "DIFFERENT") << std::endl;
+
+    NS_ABORT_MSG_IF(!identical, "the PSD kernel results differ from the SpectrumValue operators");
+    return 0;
+}
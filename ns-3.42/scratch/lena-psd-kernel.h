@@ -0,0 +1,208 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef LENA_PSD_KERNEL_H
+#define LENA_PSD_KERNEL_H
+
+#include <ns3/assert.h>
+#include <ns3/spectrum-value.h>
+
+#include <cstddef>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define LENA_PSD_KERNEL_X86 1
+#include <immintrin.h>
+#endif
+
+namespace ns3
+{
+
+/**
+ * Per-RB kernels for the power spectral density sums done by the REM helper                           REM 헬퍼와 LteInterference가 수행하는 전력 스펙트럼 밀도(PSD) 합산 및
+ * and by LteInterference, working on the raw values of a SpectrumValue.                                SINR 나눗셈을 SpectrumValue의 원시 값에 대해 수행하는 RB 단위 커널
+ *
+ * Every element is computed with the same operations, in the same order, as                            모든 원소는 SpectrumValue 연산자와 같은 연산을 같은 순서로 계산하므로
+ * the SpectrumValue operators, so the results are bit-for-bit identical to                             결과는 기존 루프와 비트 단위로 동일합니다.
+ * the existing loops. On x86 the AVX2 path is selected at run time when the                            x86에서는 CPU가 AVX2를 지원하면 실행 시간에 AVX2 경로가 선택되며,
+ * CPU supports it, otherwise the scalar fallback is used.                                              그렇지 않으면 스칼라 경로가 사용됩니다.
+ */
+namespace psdkernel
+{
+
+/**
+ * \return true if the AVX2 path is used on this machine                                                이 머신에서 AVX2 경로를 사용하면 참
+ */
+inline bool
+HasAvx2()
+{
+#ifdef LENA_PSD_KERNEL_X86
+    static const bool hasAvx2 = __builtin_cpu_supports("avx2");
+    return hasAvx2;
+#else
+    return false;
+#endif
+}
+
+/**
+ * Scalar version of Accumulate().                                                                      Accumulate()의 스칼라 버전
+ *
+ * \param sum the per-RB sum, updated in place                                                          RB별 합계 (제자리에서 갱신)
+ * \param psd the per-RB values to add                                                                  더할 RB별 값
+ * \param n the number of RBs                                                                           RB 수
+ */
+inline void
+AccumulateScalar(double* sum, const double* psd, std::size_t n)
+{
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        sum[i] += psd[i];
+    }
+}
+
+/**
+ * Scalar version of Sinr().                                                                            Sinr()의 스칼라 버전
+ *
+ * \param sinr the per-RB SINR, output                                                                  RB별 SINR (출력)
+ * \param rx the per-RB power of the wanted signal                                                      원하는 신호의 RB별 전력
+ * \param all the per-RB power of all the signals, wanted one included                                  원하는 신호를 포함한 모든 신호의 RB별 전력
+ * \param noise the per-RB noise power                                                                  RB별 잡음 전력
+ * \param n the number of RBs                                                                           RB 수
+ */
+inline void
+SinrScalar(double* sinr, const double* rx, const double* all, const double* noise, std::size_t n)
+{
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        sinr[i] = rx[i] / (all[i] - rx[i] + noise[i]);
+    }
+}
+
+#ifdef LENA_PSD_KERNEL_X86
+/// AVX2 version of Accumulate()                                                                        Accumulate()의 AVX2 버전
+__attribute__((target("avx2"))) inline void
+AccumulateAvx2(double* sum, const double* psd, std::size_t n)
+{
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        __m256d s = _mm256_loadu_pd(sum + i);
+        __m256d p = _mm256_loadu_pd(psd + i);
+        _mm256_storeu_pd(sum + i, _mm256_add_pd(s, p));
+    }
+    AccumulateScalar(sum + i, psd + i, n - i);
+}
+
+/// AVX2 version of Sinr()                                                                              Sinr()의 AVX2 버전
+__attribute__((target("avx2"))) inline void
+SinrAvx2(double* sinr, const double* rx, const double* all, const double* noise, std::size_t n)
+{
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        __m256d r = _mm256_loadu_pd(rx + i);
+        __m256d a = _mm256_loadu_pd(all + i);
+        __m256d w = _mm256_loadu_pd(noise + i);
+        __m256d interference = _mm256_add_pd(_mm256_sub_pd(a, r), w);
+        _mm256_storeu_pd(sinr + i, _mm256_div_pd(r, interference));
+    }
+    SinrScalar(sinr + i, rx + i, all + i, noise + i, n - i);
+}
+#endif
+
+/**
+ * Add a PSD to a running per-RB sum: sum[i] += psd[i].                                                 PSD를 RB별 누적 합에 더합니다: sum[i] += psd[i]
+ *
+ * \param sum the per-RB sum, updated in place                                                          RB별 합계 (제자리에서 갱신)
+ * \param psd the per-RB values to add                                                                  더할 RB별 값
+ * \param n the number of RBs                                                                           RB 수
+ */
+inline void
+Accumulate(double* sum, const double* psd, std::size_t n)
+{
+#ifdef LENA_PSD_KERNEL_X86
+    if (HasAvx2())
+    {
+        AccumulateAvx2(sum, psd, n);
+        return;
+    }
+#endif
+    AccumulateScalar(sum, psd, n);
+}
+
+/**
+ * Compute the per-RB SINR the way LteInterference does:                                                LteInterference와 같은 방식으로 RB별 SINR을 계산합니다:
+ * sinr[i] = rx[i] / (all[i] - rx[i] + noise[i]).
+ *
+ * \param sinr the per-RB SINR, output                                                                  RB별 SINR (출력)
+ * \param rx the per-RB power of the wanted signal                                                      원하는 신호의 RB별 전력
+ * \param all the per-RB power of all the signals, wanted one included                                  원하는 신호를 포함한 모든 신호의 RB별 전력
+ * \param noise the per-RB noise power                                                                  RB별 잡음 전력
+ * \param n the number of RBs                                                                           RB 수
+ */
+inline void
+Sinr(double* sinr, const double* rx, const double* all, const double* noise, std::size_t n)
+{
+#ifdef LENA_PSD_KERNEL_X86
+    if (HasAvx2())
+    {
+        SinrAvx2(sinr, rx, all, noise, n);
+        return;
+    }
+#endif
+    SinrScalar(sinr, rx, all, noise, n);
+}
+
+/**
+ * SpectrumValue overload of Accumulate().                                                              Accumulate()의 SpectrumValue 오버로드
+ *
+ * \param sum the per-RB sum, updated in place                                                          RB별 합계 (제자리에서 갱신)
+ * \param psd the PSD to add, defined over the same SpectrumModel                                       더할 PSD (같은 SpectrumModel 사용)
+ */
+inline void
+Accumulate(SpectrumValue& sum, const SpectrumValue& psd)
+{
+    NS_ASSERT(sum.GetSpectrumModelUid() == psd.GetSpectrumModelUid());
+    Accumulate(&(*sum.ValuesBegin()), &(*psd.ConstValuesBegin()), sum.GetValuesN());
+}
+
+/**
+ * SpectrumValue overload of Sinr().                                                                    Sinr()의 SpectrumValue 오버로드
+ *
+ * \param sinr the per-RB SINR, output                                                                  RB별 SINR (출력)
+ * \param rx the PSD of the wanted signal                                                               원하는 신호의 PSD
+ * \param all the sum of the PSDs of all the signals                                                    모든 신호 PSD의 합
+ * \param noise the noise PSD                                                                           잡음 PSD
+ */
+inline void
+Sinr(SpectrumValue& sinr,
+     const SpectrumValue& rx,
+     const SpectrumValue& all,
+     const SpectrumValue& noise)
+{
+    NS_ASSERT(sinr.GetSpectrumModelUid() == rx.GetSpectrumModelUid());
+    NS_ASSERT(all.GetSpectrumModelUid() == rx.GetSpectrumModelUid());
+    NS_ASSERT(noise.GetSpectrumModelUid() == rx.GetSpectrumModelUid());
+    Sinr(&(*sinr.ValuesBegin()),
+         &(*rx.ConstValuesBegin()),
+         &(*all.ConstValuesBegin()),
+         &(*noise.ConstValuesBegin()),
+         sinr.GetValuesN());
+}
+
+} // namespace psdkernel
+
+} // namespace ns3
+
+#endif // LENA_PSD_KERNEL_H
@@ -17,6 +17,12 @@
  * Author: Vignesh Babu <ns3-dev@esk.fraunhofer.de>
  */
 
+#include "lena-lte-binary-traces.h"
+#include "lena-lte-device-registry.h"
+#include "lena-lte-rrc-event-log.h"
+#include "lena-lte-trace-connector.h"
+#include "lena-throughput-binner.h"
+
 #include "ns3/applications-module.h"
 #include "ns3/core-module.h"
 #include "ns3/internet-module.h"
@@ -38,34 +44,22 @@ NS_LOG_COMPONENT_DEFINE("LenaRadioLinkFailure");
 // behavior during and after the simulation.
 uint16_t counterN310FirsteNB = 0;        //!< Counter of N310 indications.                              N310 표시 횟수 카운터
 Time t310StartTimeFirstEnb = Seconds(0); //!< Time of first N310 indication.                            첫 번째 N310 표시 시간
-uint32_t ByteCounter = 0;                //!< Byte counter.                                             바이트 카운터
-uint32_t oldByteCounter = 0;             //!< Old Byte counter,                                         이전 바이트 카운터
+bool printRrcEvents = true;              //!< Print the RRC events (false with --rrcEventLog).          RRC 이벤트 출력 여부 (--rrcEventLog이면 거짓)
 
 /**
  * Print the position of a UE with given IMSI.                                                          특정 IMSI를 가진 UE의 위치를 출력합니다.
  *
+ * \param devices The registered LTE devices.                                                           등록된 LTE 장치
  * \param imsi The IMSI.                                                                                IMSI 번호
  */
 void
-PrintUePosition(uint64_t imsi)
+PrintUePosition(const LteDeviceRegistry* devices, uint64_t imsi)
 {
-    for (auto it = NodeList::Begin(); it != NodeList::End(); ++it)
+    const LteDeviceRegistry::UeEntry* ue = devices->FindUe(imsi);
+    if (ue)
     {
-        Ptr<Node> node = *it;
-        int nDevs = node->GetNDevices();
-        for (int j = 0; j < nDevs; j++)
-        {
-            Ptr<LteUeNetDevice> uedev = node->GetDevice(j)->GetObject<LteUeNetDevice>();
-            if (uedev)
-            {
-                if (imsi == uedev->GetImsi())
-                {
-                    Vector pos = node->GetObject<MobilityModel>()->GetPosition();
-                    std::cout << "IMSI : " << uedev->GetImsi() << " at " << pos.x << "," << pos.y
-                              << std::endl;
-                }
-            }
-        }
+        Vector pos = ue->node->GetObject<MobilityModel>()->GetPosition();
+        std::cout << "IMSI : " << imsi << " at " << pos.x << "," << pos.y << std::endl;
     }
 }
 
@@ -95,9 +89,12 @@ NotifyConnectionEstablishedUe(std::string context, uint64_t imsi, uint16_t celli
 void
 NotifyConnectionEstablishedEnb(std::string context, uint64_t imsi, uint16_t cellId, uint16_t rnti)
 {
-    std::cout << Simulator::Now().As(Time::S) << " " << context << " eNB cell id " << cellId
-              << ": successful connection of UE with IMSI " << imsi << " RNTI " << rnti
-              << std::endl;
+    if (printRrcEvents)
+    {
+        std::cout << Simulator::Now().As(Time::S) << " " << context << " eNB cell id " << cellId
+                  << ": successful connection of UE with IMSI " << imsi << " RNTI " << rnti
+                  << std::endl;
+    }
     // In this example, a UE should experience RLF at least one time in                                 이 예제에서는, 셀 1에 연결된 UE가 RLF를 경험할 때마다 N310 표시를 카운트
     // cell 1. For the case, when there is only one eNB with ideal RRC,                                 하여 처리합니다.
     // a UE might reconnects to the eNB multiple times due to more than
@@ -206,9 +203,12 @@ PhySyncDetection(uint16_t n310,
                  std::string type,
                  uint8_t count)
 {
-    std::cout << Simulator::Now().As(Time::S) << " IMSI " << imsi << ", RNTI " << rnti
-              << ", Cell id " << cellId << ", " << type << ", no of sync indications: " << +count
-              << std::endl;
+    if (printRrcEvents)
+    {
+        std::cout << Simulator::Now().As(Time::S) << " IMSI " << imsi << ", RNTI " << rnti
+                  << ", Cell id " << cellId << ", " << type
+                  << ", no of sync indications: " << +count << std::endl;
+    }
 
     if (type == "Notify out of sync" && cellId == 1)                                                    // 셀 1에서 "out of sync" 유형의 PHY 문제가 발생하면 N310 표시 횟수를
     {                                                                                                   // 증가시킵니다.
@@ -225,18 +225,26 @@ PhySyncDetection(uint16_t n310,
  * Radio link failure tracer.                                                                           무선 링크 실패 추적기
  *
  * \param t310 310 data.                                                                                T310 데이터
+ * \param devices The registered LTE devices.                                                           등록된 LTE 장치
  * \param imsi The IMSI.                                                                                IMSI 번호
  * \param cellId The Cell ID.                                                                           셀 ID
  * \param rnti The RNTI.                                                                                RNTI
  */
 void
-RadioLinkFailure(Time t310, uint64_t imsi, uint16_t cellId, uint16_t rnti)
+RadioLinkFailure(Time t310,
+                 const LteDeviceRegistry* devices,
+                 uint64_t imsi,
+                 uint16_t cellId,
+                 uint16_t rnti)
 {
-    std::cout << Simulator::Now() << " IMSI " << imsi << ", RNTI " << rnti << ", Cell id " << cellId
-              << ", radio link failure detected" << std::endl
-              << std::endl;
+    if (printRrcEvents)
+    {
+        std::cout << Simulator::Now() << " IMSI " << imsi << ", RNTI " << rnti << ", Cell id "
+                  << cellId << ", radio link failure detected" << std::endl
+                  << std::endl;
 
-    PrintUePosition(imsi);                                                                              // RLF가 발생한 IMSI의 위치를 출력합니다.
+        PrintUePosition(devices, imsi);                                                                 // RLF가 발생한 IMSI의 위치를 출력합니다.
+    }
 
     if (cellId == 1)                                                                                    // 셀 1에서 RLF가 발생했을 경우, T310 타이머가 올바른 시간에 만료되었는지
     {                                                                                                   // 확인합니다.
@@ -295,47 +303,6 @@ NotifyRaResponseTimeoutUe(uint64_t imsi,
               << ", UE RA response timeout" << std::endl;
 }
 
-/**
- * Receive a packet.                                                                                    패킷 수신 핸들러
- *
- * \param packet The packet.                                                                            수신된 패킷
- */
-void
-ReceivePacket(Ptr<const Packet> packet, const Address&)
-{
-    ByteCounter += packet->GetSize();
-}
-
-/**
- * Write the throughput to file.                                                                        파일에 throughtput을 작성합니다.
- *
- * \param firstWrite True if first time writing.                                                        첫 번째 쓰기 여부
- * \param binSize Bin size.                                                                             빈 크기
- * \param fileName Output filename.                                                                     출력 파일 이름
- */
-void
-Throughput(bool firstWrite, Time binSize, std::string fileName)
-{
-    std::ofstream output;
-
-    if (firstWrite)
-    {
-        output.open(fileName, std::ofstream::out);
-        firstWrite = false;
-    }
-    else
-    {
-        output.open(fileName, std::ofstream::app);
-    }
-
-    // Instantaneous throughput every 200 ms                                                            200ms마다 순간적인 throughput을 계산하여 파일에 기록합니다.
-
-    double throughput = (ByteCounter - oldByteCounter) * 8 / binSize.GetSeconds() / 1024 / 1024;
-    output << Simulator::Now().As(Time::S) << " " << throughput << std::endl;
-    oldByteCounter = ByteCounter;
-    Simulator::Schedule(binSize, &Throughput, firstWrite, binSize, fileName);
-}
-
 /**
  * Sample simulation script for radio link failure.                                                     라디오 링크 실패를 검증하기 위한 LTE 네트워크 시뮬레이션 스크립트 예제입니다.
  * By default, only one eNodeB and one UE is considered for verifying                                   기본적으로 하나의 eNB와 하나의 UE만 고려되며, UE는 초기에 eNB의 커버리지에
@@ -365,6 +332,8 @@ main(int argc, char* argv[])
     bool enableCtrlErrorModel = true;                                                                   // 제어 오류 모델 활성화 여부
     bool enableDataErrorModel = true;                                                                   // 데이터 오류 모델 활성화 여부
     bool enableNsLogs = false;                                                                          // ns-3 로깅 활성화 여부
+    std::string traceFormat = "text";                                                                   // MAC/RLC/PDCP 트레이스 형식
+    bool rrcEventLog = false;                                                                           // RRC 이벤트를 이진 로그로 기록할지 여부
 
     CommandLine cmd(__FILE__);
     cmd.AddValue("simTime", "Total duration of the simulation (in seconds)", simTime);                  // 시뮬레이션 총 시간 (초 단위)
@@ -377,7 +346,15 @@ main(int argc, char* argv[])
     cmd.AddValue("enableCtrlErrorModel", "Enable control error model", enableCtrlErrorModel);           // 제어 오류 모델 활성화 여부
     cmd.AddValue("enableDataErrorModel", "Enable data error model", enableDataErrorModel);              // 데이터 오류 모델 활성화 여부
     cmd.AddValue("enableNsLogs", "Enable ns-3 logging (debug builds)", enableNsLogs);                   // ns-3 로깅 활성화 여부 (디버그 빌드에서)
+    cmd.AddValue("traceFormat",                                                                         // MAC/RLC/PDCP 트레이스 형식: text 또는 binary
+                 "Format of the MAC/RLC/PDCP traces: text (LteHelper) or binary (LteBinaryTraces)",
+                 traceFormat);
+    cmd.AddValue("rrcEventLog",                                                                         // RRC 이벤트를 출력하는 대신 LteRrcEvents.bin에 기록
+                 "Record the RRC events in LteRrcEvents.bin instead of printing them",
+                 rrcEventLog);
     cmd.Parse(argc, argv);
+    NS_ABORT_MSG_IF(traceFormat != "text" && traceFormat != "binary",
+                    "traceFormat must be text or binary");
 
     if (enableNsLogs)
     {
@@ -512,6 +489,10 @@ main(int argc, char* argv[])
     ueDevs = lteHelper->InstallUeDevice(ueNodes);
     randomStream += lteHelper->AssignStreams(ueDevs, randomStream);
 
+    LteDeviceRegistry devices;                                                                          // RLF 시 UE 위치 조회용 장치 색인
+    devices.Add(enbDevs);
+    devices.Add(ueDevs);
+
     NS_LOG_INFO("Install the IP stack on the UEs");
     internet.Install(ueNodes);
     Ipv4InterfaceContainer ueIpIfaces;
@@ -538,9 +519,15 @@ main(int argc, char* argv[])
 
     NS_LOG_DEBUG("UDP will use application interval " << udpInterval.As(Time::S) << " sec");
 
+    // Instantaneous DL throughput every 200 ms                                                         200ms마다 순간적인 DL throughput을 계산하여 파일에 기록합니다.
+    std::string rrcType = useIdealRrc ? "ideal_rrc" : "real_rrc";
+    std::string fileName = "rlf_dl_thrput_" + std::to_string(enbNodes.GetN()) + "_eNB_" + rrcType;
+    ThroughputBinner throughput(fileName, Seconds(0.2));
+
     for (uint32_t u = 0; u < numberOfUes; ++u)
     {
         Ptr<Node> ue = ueNodes.Get(u);
+        uint64_t imsi = ueDevs.Get(u)->GetObject<LteUeNetDevice>()->GetImsi();
         // Set the default gateway for the UE
         Ptr<Ipv4StaticRouting> ueStaticRouting =
             ipv4RoutingHelper.GetStaticRouting(ue->GetObject<Ipv4>());
@@ -566,6 +553,8 @@ main(int argc, char* argv[])
             PacketSinkHelper dlPacketSinkHelper("ns3::UdpSocketFactory",
                                                 InetSocketAddress(Ipv4Address::GetAny(), dlPort));
             dlServerApps.Add(dlPacketSinkHelper.Install(ue));
+            // the default bearer has EPS bearer ID 1, the dedicated ones follow                        기본 베어러의 EPS 베어러 ID는 1이며, 전용 베어러가 그 뒤를 잇습니다.
+            throughput.ConnectPacketSink(DynamicCast<PacketSink>(dlServerApps.Get(0)), imsi, b + 2);
 
             NS_LOG_LOGIC("installing UDP UL app for UE " << u + 1);                                     // 원격 호스트에 대한 UDP 애플리케이션 설치(UL)
             UdpClientHelper ulClientHelper(remoteHostAddr, ulPort);
@@ -598,50 +587,63 @@ main(int argc, char* argv[])
     }
     NS_LOG_INFO("Enable Lte traces and connect custom trace sinks");                                    // LTE 추적 활성화 및 사용자 정의 추적 시간 스케줄링
 
-    lteHelper->EnableTraces();
-    Ptr<RadioBearerStatsCalculator> rlcStats = lteHelper->GetRlcStats();
-    rlcStats->SetAttribute("EpochDuration", TimeValue(Seconds(0.05)));
-    Ptr<RadioBearerStatsCalculator> pdcpStats = lteHelper->GetPdcpStats();
-    pdcpStats->SetAttribute("EpochDuration", TimeValue(Seconds(0.05)));
-
-    Config::Connect("/NodeList/*/DeviceList/*/LteEnbRrc/ConnectionEstablished",                         // 이벤트 핸들러 연결
-                    MakeCallback(&NotifyConnectionEstablishedEnb));
-    Config::Connect("/NodeList/*/DeviceList/*/LteUeRrc/ConnectionEstablished",
-                    MakeCallback(&NotifyConnectionEstablishedUe));
-    Config::ConnectWithoutContext("/NodeList/*/DeviceList/*/LteUeRrc/StateTransition",
-                                  MakeCallback(&UeStateTransition));
-    Config::ConnectWithoutContext("/NodeList/*/DeviceList/*/LteUeRrc/PhySyncDetection",
-                                  MakeBoundCallback(&PhySyncDetection, n310));
-    Config::ConnectWithoutContext("/NodeList/*/DeviceList/*/LteUeRrc/RadioLinkFailure",
-                                  MakeBoundCallback(&RadioLinkFailure, t310));
-    Config::ConnectWithoutContext("/NodeList/*/DeviceList/*/LteEnbRrc/NotifyConnectionRelease",
-                                  MakeCallback(&NotifyConnectionReleaseAtEnodeB));
-    Config::ConnectWithoutContext("/NodeList/*/DeviceList/*/LteEnbRrc/RrcTimeout",
-                                  MakeCallback(&EnbRrcTimeout));
-    Config::ConnectWithoutContext("/NodeList/*/DeviceList/*/LteUeRrc/RandomAccessError",
-                                  MakeCallback(&NotifyRandomAccessErrorUe));
-    Config::ConnectWithoutContext("/NodeList/*/DeviceList/*/LteUeRrc/ConnectionTimeout",
-                                  MakeCallback(&NotifyConnectionTimeoutUe));
-    Config::ConnectWithoutContext("/NodeList/*/DeviceList/*/$ns3::LteUeNetDevice/"
-                                  "ComponentCarrierMapUe/*/LteUeMac/RaResponseTimeout",
-                                  MakeCallback(&NotifyRaResponseTimeoutUe));
-
-    // Trace sink for the packet sink of UE                                                             UE 패킷 수신 추적
-    std::ostringstream oss;
-    oss << "/NodeList/" << ueNodes.Get(0)->GetId() << "/ApplicationList/0/$ns3::PacketSink/Rx";
-    Config::ConnectWithoutContext(oss.str(), MakeCallback(&ReceivePacket));
-
-    bool firstWrite = true;
-    std::string rrcType = useIdealRrc ? "ideal_rrc" : "real_rrc";
-    std::string fileName = "rlf_dl_thrput_" + std::to_string(enbNodes.GetN()) + "_eNB_" + rrcType;
-    Time binSize = Seconds(0.2);
-    Simulator::Schedule(Seconds(0.47), &Throughput, firstWrite, binSize, fileName);
+    LteBinaryTraces binaryTraces;
+    if (traceFormat == "binary")
+    {
+        lteHelper->EnablePhyTraces();
+        // lena-lte-trace-converter rebuilds the stats files with the same epochs                       같은 에포크로 통계 파일을 다시 만듭니다.
+        binaryTraces.SetEpoch(Seconds(0), Seconds(0.05));
+        binaryTraces.EnableTraces();
+    }
+    else
+    {
+        lteHelper->EnableTraces();
+        Ptr<RadioBearerStatsCalculator> rlcStats = lteHelper->GetRlcStats();
+        rlcStats->SetAttribute("EpochDuration", TimeValue(Seconds(0.05)));
+        Ptr<RadioBearerStatsCalculator> pdcpStats = lteHelper->GetPdcpStats();
+        pdcpStats->SetAttribute("EpochDuration", TimeValue(Seconds(0.05)));
+    }
+
+    // lena-lte-rrc-event-decoder prints the binary RRC events as text                                  lena-lte-rrc-event-decoder가 이진 RRC 이벤트를 텍스트로 출력합니다.
+    LteRrcEventLog eventLog;
+    if (rrcEventLog)
+    {
+        eventLog.Enable();
+        printRrcEvents = false;
+    }
+
+    // the sinks checking the RLF are always connected                                                  RLF를 검증하는 싱크는 항상 연결합니다.
+    LteTraceConnector traces;
+    traces.ConnectEnbRrc("ConnectionEstablished", MakeCallback(&NotifyConnectionEstablishedEnb));
+    traces.ConnectUeRrcWithoutContext("PhySyncDetection",
+                                      MakeBoundCallback(&PhySyncDetection, n310));
+    traces.ConnectUeRrcWithoutContext("RadioLinkFailure",
+                                      MakeBoundCallback(&RadioLinkFailure, t310, &devices));
+    if (printRrcEvents)
+    {
+        traces.ConnectUeRrc("ConnectionEstablished", MakeCallback(&NotifyConnectionEstablishedUe));
+        traces.ConnectUeRrcWithoutContext("StateTransition", MakeCallback(&UeStateTransition));
+        traces.ConnectEnbRrcWithoutContext("NotifyConnectionRelease",
+                                           MakeCallback(&NotifyConnectionReleaseAtEnodeB));
+        traces.ConnectEnbRrcWithoutContext("RrcTimeout", MakeCallback(&EnbRrcTimeout));
+        traces.ConnectUeRrcWithoutContext("RandomAccessError",
+                                          MakeCallback(&NotifyRandomAccessErrorUe));
+        traces.ConnectUeRrcWithoutContext("ConnectionTimeout",
+                                          MakeCallback(&NotifyConnectionTimeoutUe));
+        traces.ConnectUeMacWithoutContext("RaResponseTimeout",
+                                          MakeCallback(&NotifyRaResponseTimeoutUe));
+    }
+
+    throughput.Start(Seconds(0.47));
 
     NS_LOG_INFO("Starting simulation...");                                                              // 시뮬레이션 시작
 
     Simulator::Stop(simTime);
 
     Simulator::Run();
+    binaryTraces.Close();
+    eventLog.Close();
+    throughput.Close();
 
     NS_ABORT_MSG_IF(counterN310FirsteNB != n310,                                                        // 테스트 결과 검증
                     "UE RRC should receive " << n310
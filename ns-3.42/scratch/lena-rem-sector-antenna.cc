@@ -17,6 +17,8 @@
  * Author: Jaume Nin <jnin@cttc.es>
  */
 
+#include "lena-rem-tiles.h"
+
 #include "ns3/config-store.h"
 #include "ns3/core-module.h"
 #include "ns3/lte-module.h"
@@ -36,7 +38,12 @@ using namespace ns3;
 int
 main(int argc, char* argv[])
 {
+    uint32_t remTiles = 1;                                                                      // REM 그리드를 나눌 타일 수
+    uint32_t remTileId = 0;                                                                     // 이번 실행에서 계산할 타일
+
     CommandLine cmd(__FILE__);
+    cmd.AddValue("remTiles", "Number of tiles the REM grid is split into", remTiles);           // REM 그리드를 나눌 타일 수
+    cmd.AddValue("remTileId", "REM tile computed by this run", remTileId);                      // 이번 실행에서 계산할 REM 타일
     cmd.Parse(argc, argv);
 
     ConfigStore inputConfig;
@@ -214,6 +221,7 @@ main(int argc, char* argv[])
     remHelper->SetAttribute("YMin", DoubleValue(-500.0));
     remHelper->SetAttribute("YMax", DoubleValue(+3500.0));
     remHelper->SetAttribute("Z", DoubleValue(1.5));
+    ConfigureRemTile(remHelper, remTiles, remTileId);
     remHelper->Install();                                                                       // REM 헬퍼 설치
 
     Simulator::Run();                                                                           // 시뮬레이션 실행
@@ -0,0 +1,109 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef LENA_REM_TILES_H
+#define LENA_REM_TILES_H
+
+#include <ns3/abort.h>
+#include <ns3/double.h>
+#include <ns3/radio-environment-map-helper.h>
+#include <ns3/string.h>
+#include <ns3/uinteger.h>
+
+#include <sstream>
+#include <string>
+
+namespace ns3
+{
+
+/**
+ * Restrict a RadioEnvironmentMapHelper to one tile of its grid.                                        RadioEnvironmentMapHelper가 그리드의 한 타일만 계산하도록 제한합니다.
+ *
+ * The REM helper walks the grid with X in the outer loop and Y in the inner                            REM 헬퍼는 X를 바깥 루프, Y를 안쪽 루프로 하여 그리드를 순회하므로
+ * loop, so the XMin..XMax range is split into nTiles contiguous strips of                              XMin..XMax 범위를 연속된 열(column) 스트립 nTiles개로 나누고
+ * columns and every tile writes its points to "<OutputFile>.tile<tileId>".                             각 타일은 "<OutputFile>.tile<tileId>" 파일에 결과를 기록합니다.
+ * Each tile is an independent simulation, hence the tiles can be computed in                           각 타일은 독립적인 시뮬레이션이므로 별도의 프로세스에서 병렬로 계산할 수 있으며,
+ * parallel by separate processes, and concatenating the tile files in tile                             타일 파일들을 타일 순서대로 이어 붙이면 직렬 실행과 같은 점들이 같은 순서로
+ * order gives a REM with the same points, in the same order, as the serial run,                        들어 있는 REM이 됩니다. 헬퍼는 X에 XStep을 누적하여 그리드를 진행하므로,
+ * up to rounding: the helper steps its grid by accumulating its X step, so the                         타일 경계도 같은 방식으로 누적하여 구하지만, 타일 내부의 X 좌표(그리고
+ * tile bounds are accumulated the same way, but the X coordinates inside a                             해당 SINR)는 직렬 실행과 마지막 몇 비트가 다를 수 있습니다.
+ * tile (and hence their SINR) may differ from the serial ones in the last bits:
+ *
+ * \code
+ *   for t in 0 1 2 3; do
+ *     ./ns3 run --no-build "lena-rem --remTiles=4 --remTileId=$t" &
+ *   done; wait
+ *   cat rem.out.tile0 rem.out.tile1 rem.out.tile2 rem.out.tile3 > rem.out
+ * \endcode
+ *
+ * Apart from that rounding, the SINR values are the same as the serial ones as                         위의 반올림 차이를 제외하면, 전파 모델이 결정적(deterministic)인 경우 SINR 값은
+ * long as the propagation models are deterministic; models drawing random                              직렬 실행과 동일합니다. 링크마다 무작위 섀도잉을 추출하는 모델은 점마다
+ * shadowing per link (e.g., HybridBuildingsPropagationLossModel with a non-zero                        다른 난수를 사용할 수 있습니다.
+ * sigma) draw their samples in a different order and are only statistically
+ * equivalent.
+ *
+ * \param remHelper the REM helper, with XMin, XMax, XRes and OutputFile already set                    XMin, XMax, XRes, OutputFile이 이미 설정된 REM 헬퍼
+ * \param nTiles the number of tiles the grid is split into                                             그리드를 나눌 타일 수
+ * \param tileId the tile computed by this run, in [0, nTiles)                                          이번 실행에서 계산할 타일 번호 [0, nTiles)
+ */
+inline void
+ConfigureRemTile(Ptr<RadioEnvironmentMapHelper> remHelper, uint32_t nTiles, uint32_t tileId)
+{
+    NS_ABORT_MSG_IF(nTiles == 0, "the number of REM tiles must be positive");                           // REM 타일 수는 양수여야 합니다.
+    NS_ABORT_MSG_IF(tileId >= nTiles, "REM tile " << tileId << " out of range [0, " << nTiles << ")");  // REM 타일 번호가 범위를 벗어났습니다.
+    if (nTiles == 1)
+    {
+        return;
+    }
+
+    DoubleValue xMin;
+    DoubleValue xMax;
+    UintegerValue xRes;
+    StringValue outputFile;
+    remHelper->GetAttribute("XMin", xMin);
+    remHelper->GetAttribute("XMax", xMax);
+    remHelper->GetAttribute("XRes", xRes);
+    remHelper->GetAttribute("OutputFile", outputFile);
+
+    // every tile needs at least two columns, since the helper divides by XRes - 1                      헬퍼가 XRes - 1로 나누므로 각 타일은 최소 두 개의 열이 필요합니다.
+    uint32_t nColumns = xRes.Get();
+    NS_ABORT_MSG_IF(2 * nTiles > nColumns,
+                    "too many REM tiles (" << nTiles << ") for XRes = " << nColumns);                   // XRes에 비해 REM 타일 수가 너무 많습니다.
+    double xStep = (xMax.Get() - xMin.Get()) / (nColumns - 1);
+    uint32_t firstColumn = tileId * nColumns / nTiles;
+    uint32_t lastColumn = (tileId + 1) * nColumns / nTiles - 1;
+    // X of the columns as the helper computes them, by accumulating the step                           헬퍼처럼 간격을 누적하여 계산한 열의 X
+    double tileXMin = xMin.Get();
+    for (uint32_t column = 0; column < firstColumn; ++column)
+    {
+        tileXMin += xStep;
+    }
+    double tileXMax = tileXMin;
+    for (uint32_t column = firstColumn; column < lastColumn; ++column)
+    {
+        tileXMax += xStep;
+    }
+
+    std::ostringstream tileFile;
+    tileFile << outputFile.Get() << ".tile" << tileId;
+    remHelper->SetAttribute("XMin", DoubleValue(tileXMin));
+    remHelper->SetAttribute("XMax", DoubleValue(tileXMax));
+    remHelper->SetAttribute("XRes", UintegerValue(lastColumn - firstColumn + 1));
+    remHelper->SetAttribute("OutputFile", StringValue(tileFile.str()));
+}
+
+} // namespace ns3
+
+#endif // LENA_REM_TILES_H
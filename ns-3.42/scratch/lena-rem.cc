@@ -18,6 +18,8 @@
  *         Nicola Baldo <nbaldo@cttc.es>
  */
 
+#include "lena-rem-tiles.h"
+
 #include "ns3/config-store.h"
 #include "ns3/core-module.h"
 #include "ns3/lte-module.h"
@@ -32,7 +34,12 @@ using namespace ns3;
 int
 main(int argc, char* argv[])
 {
+    uint32_t remTiles = 1;                                                              // REM 그리드를 나눌 타일 수
+    uint32_t remTileId = 0;                                                             // 이번 실행에서 계산할 타일
+
     CommandLine cmd(__FILE__);
+    cmd.AddValue("remTiles", "Number of tiles the REM grid is split into", remTiles);   // REM 그리드를 나눌 타일 수
+    cmd.AddValue("remTileId", "REM tile computed by this run", remTileId);              // 이번 실행에서 계산할 REM 타일
     cmd.Parse(argc, argv);
 
     // to save a template default attribute file run it like this:                      기본 속성 파일을 저장하기 위한 명령어 예제
@@ -98,6 +105,7 @@ main(int argc, char* argv[])
     remHelper->SetAttribute("YMin", DoubleValue(-300.0));
     remHelper->SetAttribute("YMax", DoubleValue(300.0));
     remHelper->SetAttribute("Z", DoubleValue(0.0));
+    ConfigureRemTile(remHelper, remTiles, remTileId);
     remHelper->Install();
 
     // here's a minimal gnuplot script that will plot the above:                        다음은 위에서 생성한 최소한의 gunplot 스크립트입니다:
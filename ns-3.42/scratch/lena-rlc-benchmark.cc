@@ -0,0 +1,181 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/core-module.h"
+#include "ns3/lte-module.h"
+#include "ns3/network-module.h"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE("LenaRlcBenchmark");
+
+/**
+ * MAC SAP provider that hands every PDU of the transmitting RLC entity to the                          송신 RLC 개체의 모든 PDU를 수신 RLC 개체에 바로 전달하는
+ * receiving one, as an error-free MAC and PHY.                                                         MAC SAP 제공자 (오류 없는 MAC 및 PHY 역할)
+ */
+class LoopbackMacSapProvider : public LteMacSapProvider
+{
+  public:
+    /**
+     * \param receiver the MAC SAP user of the receiving RLC entity                                     수신 RLC 개체의 MAC SAP 사용자
+     */
+    explicit LoopbackMacSapProvider(LteMacSapUser* receiver)
+        : m_receiver(receiver)
+    {
+    }
+
+    void TransmitPdu(TransmitPduParameters params) override
+    {
+        ++m_pdus;
+        m_bytes += params.pdu->GetSize();
+        LteMacSapUser::ReceivePduParameters rxParams;
+        rxParams.p = params.pdu;
+        rxParams.rnti = params.rnti;
+        rxParams.lcid = params.lcid;
+        m_receiver->ReceivePdu(rxParams);
+    }
+
+    void ReportBufferStatus(ReportBufferStatusParameters params) override
+    {
+    }
+
+    uint64_t m_pdus{0};  ///< PDUs transmitted
+    uint64_t m_bytes{0}; ///< bytes of the PDUs transmitted
+
+  private:
+    LteMacSapUser* m_receiver; ///< MAC SAP user of the receiving RLC entity
+};
+
+/// RLC SAP user counting the SDUs delivered by the receiving RLC entity                                수신 RLC 개체가 전달한 SDU를 세는 RLC SAP 사용자
+class CountingRlcSapUser : public LteRlcSapUser
+{
+  public:
+    void ReceivePdcpPdu(Ptr<Packet> p) override
+    {
+        ++m_sdus;
+        m_bytes += p->GetSize();
+    }
+
+    uint64_t m_sdus{0};  ///< SDUs delivered
+    uint64_t m_bytes{0}; ///< bytes of the SDUs delivered
+};
+
+/**
+ * One TTI of the full-buffer flow: fill the transmission buffer with the SDUs                          전체 버퍼 흐름의 한 TTI: TTI당 SDU로 송신 버퍼를 채우고 (MaxTxBufferSize를
+ * of the TTI (the ones exceeding MaxTxBufferSize are dropped by the RLC), give                         넘는 SDU는 RLC가 버림) 송신 개체에 전송 기회를 한 번 준 뒤 다음 TTI를
+ * one transmission opportunity to the transmitting entity and schedule the                             예약합니다.
+ * next TTI.
+ *
+ * \param txRlc the transmitting RLC entity                                                             송신 RLC 개체
+ * \param sduSize the SDU size [bytes]                                                                  SDU 크기 [바이트]
+ * \param sdusPerTti the SDUs offered per TTI                                                           TTI당 제공하는 SDU 수
+ * \param tbBytes the size of the transmission opportunity [bytes]                                      전송 기회의 크기 [바이트]
+ */
+void
+Tti(Ptr<LteRlc> txRlc, uint32_t sduSize, uint32_t sdusPerTti, uint32_t tbBytes)
+{
+    LteRlcSapProvider::TransmitPdcpPduParameters sdu;
+    sdu.rnti = 1;
+    sdu.lcid = 3;
+    for (uint32_t i = 0; i < sdusPerTti; ++i)
+    {
+        sdu.pdcpPdu = Create<Packet>(sduSize);
+        txRlc->GetLteRlcSapProvider()->TransmitPdcpPdu(sdu);
+    }
+
+    LteMacSapUser::TxOpportunityParameters txOp;
+    txOp.bytes = tbBytes;
+    txOp.layer = 0;
+    txOp.harqId = 0;
+    txOp.componentCarrierId = 0;
+    txOp.rnti = 1;
+    txOp.lcid = 3;
+    txRlc->GetLteMacSapUser()->NotifyTxOpportunity(txOp);
+
+    Simulator::Schedule(MilliSeconds(1), &Tti, txRlc, sduSize, sdusPerTti, tbBytes);
+}
+
+/**
+ * Throughput benchmark of LteRlcUm: one transmitting and one receiving entity                          LteRlcUm 처리량 벤치마크: 송신 개체와 수신 개체 하나씩을 오류 없는
+ * connected by an error-free loopback MAC, with a full buffer and one                                  루프백 MAC으로 연결하고, 전체 버퍼와 TTI당 한 번의 전송 기회(기본값은
+ * transmission opportunity per TTI, by default the TB of 100 PRBs (20 MHz) at                          MCS 28에서 100 PRB(20 MHz)의 TB)를 사용합니다. 각 PDU는 SDU를
+ * MCS 28. Every PDU segments and concatenates SDUs, so the RLC PDUs processed                          분할하고 연결하므로, 벽시계 1초당 처리된 RLC PDU 수는 분할/연결
+ * per second of wall clock time measure the cost of the segmentation and                               경로의 비용을 측정합니다. 작은 TB(--nRbs)는 연결 없이 분할을,
+ * concatenation path. Small TBs (--nRbs) stress segmentation without                                   작은 SDU(--sduSize)는 연결을 강조합니다.
+ * concatenation, small SDUs (--sduSize) stress concatenation.
+ *
+ * ./ns3 run "lena-rlc-benchmark --simTime=10 --sduSize=1400"
+ */
+int
+main(int argc, char* argv[])
+{
+    double simTime = 10.0;                                                                              // 시뮬레이션 시간 [s]
+    uint32_t sduSize = 1400;                                                                            // SDU 크기 [바이트]
+    uint16_t nRbs = 100;                                                                                // 전송 기회의 PRB 수
+    uint16_t mcs = 28;                                                                                  // 전송 기회의 MCS
+    uint32_t maxTxBufferSize = 10 * 1024;                                                               // RLC 송신 버퍼 크기 [바이트]
+
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("simTime", "Simulation time [s]", simTime);                                            // 시뮬레이션 시간 [s]
+    cmd.AddValue("sduSize", "Size of the SDUs (PDCP PDUs) [bytes]", sduSize);                           // SDU(PDCP PDU) 크기 [바이트]
+    cmd.AddValue("nRbs", "Number of PRBs of each transmission opportunity", nRbs);                      // 각 전송 기회의 PRB 수
+    cmd.AddValue("mcs", "MCS of each transmission opportunity", mcs);                                   // 각 전송 기회의 MCS
+    cmd.AddValue("maxTxBufferSize",
+                 "MaxTxBufferSize of the RLC entity, as set by lena-dual-stripe [bytes]",               // lena-dual-stripe가 설정하는 RLC 개체의 MaxTxBufferSize [바이트]
+                 maxTxBufferSize);
+    cmd.Parse(argc, argv);
+
+    NS_ABORT_MSG_IF(sduSize == 0, "the SDUs must not be empty");
+
+    Ptr<LteAmc> amc = CreateObject<LteAmc>();
+    uint32_t tbBytes = amc->GetDlTbSizeFromMcs(mcs, nRbs) / 8;
+    uint32_t sdusPerTti = tbBytes / sduSize + 2;
+
+    Config::SetDefault("ns3::LteRlcUm::MaxTxBufferSize", UintegerValue(maxTxBufferSize));
+    Ptr<LteRlcUm> txRlc = CreateObject<LteRlcUm>();
+    Ptr<LteRlcUm> rxRlc = CreateObject<LteRlcUm>();
+    LoopbackMacSapProvider macSapProvider(rxRlc->GetLteMacSapUser());
+    CountingRlcSapUser rlcSapUser;
+    for (Ptr<LteRlcUm> rlc : {txRlc, rxRlc})
+    {
+        rlc->SetRnti(1);
+        rlc->SetLcId(3);
+        rlc->SetLteMacSapProvider(&macSapProvider);
+        rlc->SetLteRlcSapUser(&rlcSapUser);
+        rlc->Initialize();
+    }
+
+    Simulator::Schedule(MilliSeconds(1), &Tti, txRlc, sduSize, sdusPerTti, tbBytes);
+    Simulator::Stop(Seconds(simTime));
+    auto start = std::chrono::steady_clock::now();
+    Simulator::Run();
+    std::chrono::duration<double> wallTime = std::chrono::steady_clock::now() - start;
+
+    std::cout << "TB " << tbBytes << " bytes, SDU " << sduSize << " bytes, MaxTxBufferSize "
+              << maxTxBufferSize << std::endl;
+    std::cout << "PDUs " << macSapProvider.m_pdus << ", SDUs delivered " << rlcSapUser.m_sdus
+              << ", RLC throughput " << std::fixed << std::setprecision(1)
+              << rlcSapUser.m_bytes * 8 / simTime / 1e6 << " Mbit/s" << std::endl;
+    std::cout << "wall time " << std::setprecision(3) << wallTime.count() << " s, "
+              << std::setprecision(0) << macSapProvider.m_pdus / wallTime.count() << " PDUs/s"
+              << std::endl;
+
+    Simulator::Destroy();
+    return 0;
+}
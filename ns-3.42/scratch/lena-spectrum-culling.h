@@ -0,0 +1,127 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef LENA_SPECTRUM_CULLING_H
+#define LENA_SPECTRUM_CULLING_H
+
+#include <ns3/abort.h>
+#include <ns3/callback.h>
+#include <ns3/double.h>
+#include <ns3/lte-helper.h>
+#include <ns3/spectrum-channel.h>
+#include <ns3/spectrum-phy.h>
+
+#include <cmath>
+#include <cstdint>
+
+namespace ns3
+{
+
+/**
+ * Do not deliver the signals received below a minimum power.                                           최소 전력보다 낮게 수신되는 신호는 전달하지 않습니다.
+ *
+ * The spectrum channels of the helper get a MaxLossDb of                                               헬퍼의 스펙트럼 채널에 MaxLossDb = maxTxPowerDbm - minRxPowerDbm을
+ * maxTxPowerDbm - minRxPowerDbm: the channel still computes the loss of every                          설정합니다. 채널은 여전히 모든 링크의 손실을 계산하지만(캐시된 경로
+ * link (a lookup with a cached pathloss model), but the links beyond it get no                         손실 모델에서는 조회), 그보다 큰 링크는 StartRx를 받지 않으므로
+ * StartRx, hence no interference chunk and no error model evaluation. Since the                        간섭 청크와 오류 모델 계산도 없습니다. 임계값은 가장 강한 송신기
+ * threshold is set for the strongest transmitter, the culling is conservative                          기준이므로 전력이 더 낮은 송신기(홈 eNB, UE)에 대해서는 보수적입니다.
+ * for lower power transmitters (home eNBs, UEs). The REM helper uses the same                          REM 헬퍼도 같은 채널을 사용하므로 잘린 신호를 보지 못합니다.
+ * channel and does not see the culled signals either.
+ *
+ * To be called before the helper creates its channels (i.e., before installing                         헬퍼가 채널을 만들기 전(즉, 첫 장치를 설치하기 전)에 호출해야 합니다.
+ * the first device).
+ *
+ * \param lteHelper the LTE helper                                                                      LTE 헬퍼
+ * \param minRxPowerDbm the minimum received power [dBm]                                                최소 수신 전력 [dBm]
+ * \param maxTxPowerDbm the highest transmission power in the scenario [dBm]                            시나리오의 최대 송신 전력 [dBm]
+ */
+inline void
+SetSpectrumCulling(Ptr<LteHelper> lteHelper, double minRxPowerDbm, double maxTxPowerDbm)
+{
+    NS_ABORT_MSG_IF(maxTxPowerDbm < minRxPowerDbm,
+                    "the minimum received power exceeds the transmission power");
+    lteHelper->SetSpectrumChannelAttribute("MaxLossDb", DoubleValue(maxTxPowerDbm - minRxPowerDbm));
+}
+
+/**
+ * Count the deliveries of a spectrum channel that were culled by MaxLossDb.                            스펙트럼 채널에서 MaxLossDb 때문에 잘린 전달 수를 셉니다.
+ *
+ * The PathLoss trace of the channel is fired for every (tx, rx) pair with the                          채널의 PathLoss 트레이스는 (송신, 수신) 쌍마다 범위 검사 전에 총 손실과
+ * total loss, before the range check, so the counter tells how many StartRx                            함께 발생하므로, 카운터는 잘라낸 StartRx 수와 전달된 수를 알려 주어
+ * were skipped and how many were delivered, to audit the accuracy of a                                 임계값의 정확도를 점검할 수 있습니다.
+ * threshold.
+ */
+class SpectrumCullingCounter
+{
+  public:
+    /**
+     * Start counting the deliveries of a channel.                                                      채널의 전달 수를 세기 시작합니다.
+     *
+     * \param channel the spectrum channel                                                              스펙트럼 채널
+     */
+    void Attach(Ptr<SpectrumChannel> channel)
+    {
+        NS_ABORT_MSG_IF(!channel, "no spectrum channel");
+        DoubleValue maxLossDb;
+        channel->GetAttribute("MaxLossDb", maxLossDb);
+        m_maxLossDb = maxLossDb.Get();
+        channel->TraceConnectWithoutContext("PathLoss",
+                                            MakeCallback(&SpectrumCullingCounter::PathLoss, this));
+    }
+
+    /**
+     * \return the number of signals that were not delivered                                            전달되지 않은 신호의 수
+     */
+    uint64_t GetCulled() const
+    {
+        return m_culled;
+    }
+
+    /**
+     * \return the number of signals that were delivered                                                전달된 신호의 수
+     */
+    uint64_t GetDelivered() const
+    {
+        return m_delivered;
+    }
+
+  private:
+    /**
+     * Sink of the PathLoss trace of the channel.                                                       채널의 PathLoss 트레이스 싱크
+     *
+     * \param txPhy the transmitting PHY                                                                송신 PHY
+     * \param rxPhy the receiving PHY                                                                   수신 PHY
+     * \param lossDb the total loss [dB]                                                                총 손실 [dB]
+     */
+    void PathLoss(Ptr<const SpectrumPhy> txPhy, Ptr<const SpectrumPhy> rxPhy, double lossDb)
+    {
+        if (lossDb > m_maxLossDb)
+        {
+            ++m_culled;
+        }
+        else
+        {
+            ++m_delivered;
+        }
+    }
+
+    double m_maxLossDb{INFINITY}; ///< MaxLossDb of the channel
+    uint64_t m_culled{0};         ///< signals not delivered
+    uint64_t m_delivered{0};      ///< signals delivered
+};
+
+} // namespace ns3
+
+#endif // LENA_SPECTRUM_CULLING_H
@@ -0,0 +1,254 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef LENA_SUBFRAME_CALENDAR_SCHEDULER_H
+#define LENA_SUBFRAME_CALENDAR_SCHEDULER_H
+
+#include <ns3/abort.h>
+#include <ns3/assert.h>
+#include <ns3/nstime.h>
+#include <ns3/scheduler.h>
+#include <ns3/uinteger.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * Event scheduler tuned for the TTI-periodic LTE workloads.                                            TTI 주기의 LTE 작업 부하에 맞춘 이벤트 스케줄러
+ *
+ * The LTE devices schedule most of their events for the next subframes, in                             LTE 장치는 대부분의 이벤트를 다음 서브프레임들에 대해, 서브프레임 경계에
+ * batches at the subframe boundaries. The events of the next Buckets *                                 일괄적으로 스케줄링합니다. 다음 Buckets * BucketWidth 동안의 이벤트는
+ * BucketWidth are kept in a calendar of fixed-width buckets (one subframe by                           고정 폭 버킷(기본값은 한 서브프레임)의 캘린더에 보관합니다. 다음 이벤트를
+ * default). The bucket holding the next event is a binary heap; the other ones                         가진 버킷은 이진 힙이고, 다른 버킷은 정렬되지 않은 벡터로서 헤드가 될 때
+ * are unsorted vectors, turned into a heap when they become the head. Hence                            힙으로 바뀝니다. 따라서 Insert()는 이후 버킷에는 O(1) 추가이고, 헤드
+ * Insert() is an O(1) append for a later bucket and an O(log m) heap push for                          버킷(m개 이벤트)에는 O(log m) 힙 삽입이며, RemoveNext()는 O(log m)
+ * the head bucket of m events, RemoveNext() is an O(log m) heap pop, and a                             힙 추출이고, 버킷을 힙으로 만드는 데는 O(m)이 듭니다. m은 대기 중인
+ * bucket costs O(m) to heapify. m counts the events of one bucket instead of                           모든 이벤트가 아니라 한 버킷의 이벤트 수입니다. MapScheduler 대비 실제
+ * all the pending ones; the actual gain over the MapScheduler is measured with                         이득은 lena-profiling-benchmark의 --scheduler로 측정합니다. 더 먼 이벤트(정지
+ * the --scheduler option of lena-profiling-benchmark. The events further away                          시간, 긴 타이머)는 순서가 있는 맵에서 기다립니다. 버킷은 재사용되므로
+ * (stop time, long timers) wait in an ordered map. The buckets are reused, so                          정상 상태에서는 메모리를 할당하지 않습니다. ns3::CalendarScheduler와 달리
+ * that no memory is allocated in the steady state. Unlike                                              버킷 폭은 고정이며 캘린더 크기를 조정하지 않습니다.
+ * ns3::CalendarScheduler, the bucket width is fixed and the calendar is never
+ * resized.
+ *
+ * It is selected with the SchedulerType global value, e.g.:                                            SchedulerType 전역 값으로 선택합니다. 예:
+ *
+ * ./ns3 run "lena-dual-stripe --SchedulerType=ns3::SubframeCalendarScheduler --reportRunTime=1"
+ */
+class SubframeCalendarScheduler : public Scheduler
+{
+  public:
+    /**
+     * \brief Get the type ID.                                                                          타입 ID를 가져옵니다.
+     * \return the object TypeId                                                                        객체 TypeId
+     */
+    static TypeId GetTypeId()
+    {
+        static TypeId tid =
+            TypeId("ns3::SubframeCalendarScheduler")
+                .SetParent<Scheduler>()
+                .SetGroupName("Lte")
+                .AddConstructor<SubframeCalendarScheduler>()
+                .AddAttribute("BucketWidth",
+                              "Time span of a bucket, one LTE subframe by default",
+                              TimeValue(MilliSeconds(1)),
+                              MakeTimeAccessor(&SubframeCalendarScheduler::SetBucketWidth),
+                              MakeTimeChecker(TimeStep(1)))
+                .AddAttribute("Buckets",
+                              "Number of buckets; the events further away than "
+                              "Buckets * BucketWidth wait in an ordered map",
+                              UintegerValue(1024),
+                              MakeUintegerAccessor(&SubframeCalendarScheduler::SetBuckets),
+                              MakeUintegerChecker<uint32_t>(1));
+        return tid;
+    }
+
+    /**
+     * Set the time span of a bucket; only possible while no event is scheduled.                        버킷의 시간 범위를 설정합니다. 스케줄된 이벤트가 없을 때만 가능합니다.
+     *
+     * \param width the bucket width                                                                    버킷 폭
+     */
+    void SetBucketWidth(Time width)
+    {
+        NS_ABORT_MSG_IF(!IsEmpty(), "the bucket width can't change with events scheduled");
+        m_width = width.GetTimeStep();
+        m_windowStart = 0;
+        m_current = 0;
+        m_next = 0;
+    }
+
+    /**
+     * Set the number of buckets; only possible while no event is scheduled.                            버킷 수를 설정합니다. 스케줄된 이벤트가 없을 때만 가능합니다.
+     *
+     * \param buckets the number of buckets                                                             버킷 수
+     */
+    void SetBuckets(uint32_t buckets)
+    {
+        NS_ABORT_MSG_IF(!IsEmpty(), "the number of buckets can't change with events scheduled");
+        m_buckets.assign(buckets, std::vector<Event>());
+        m_current = (m_windowStart / m_width) % buckets;
+        m_next = m_current;
+    }
+
+    void Insert(const Event& ev) override
+    {
+        NS_ASSERT(ev.key.m_ts >= m_windowStart);
+        if (ev.key.m_ts - m_windowStart >= m_width * m_buckets.size())
+        {
+            m_far.emplace(ev.key, ev.impl);
+            return;
+        }
+        std::size_t b = (ev.key.m_ts / m_width) % m_buckets.size();
+        std::vector<Event>& bucket = m_buckets[b];
+        if (m_count == 0 || Offset(b) < Offset(m_next))
+        {
+            m_next = b; // the buckets before m_next are empty
+        }
+        ++m_count;
+        bucket.push_back(ev);
+        if (b == m_next)
+        {
+            std::push_heap(bucket.begin(), bucket.end(), &IsLater);
+        }
+    }
+
+    bool IsEmpty() const override
+    {
+        return m_count == 0 && m_far.empty();
+    }
+
+    Event PeekNext() const override
+    {
+        NS_ASSERT(!IsEmpty());
+        if (m_count > 0)
+        {
+            const Event& ev = m_buckets[m_next].front();
+            if (m_far.empty() || ev.key < m_far.begin()->first)
+            {
+                return ev;
+            }
+        }
+        return Event{m_far.begin()->second, m_far.begin()->first};
+    }
+
+    Event RemoveNext() override
+    {
+        Event ev = PeekNext();
+        std::vector<Event>& bucket = m_buckets[m_next];
+        if (m_count > 0 && bucket.front().key.m_uid == ev.key.m_uid)
+        {
+            --m_count;
+            std::pop_heap(bucket.begin(), bucket.end(), &IsLater);
+            bucket.pop_back();
+            if (bucket.empty() && m_count > 0)
+            {
+                AdvanceNext();
+            }
+        }
+        else
+        {
+            m_far.erase(m_far.begin());
+        }
+        // the window now starts with the bucket of the current time                                    이제 윈도우는 현재 시간의 버킷에서 시작합니다
+        m_windowStart = ev.key.m_ts - ev.key.m_ts % m_width;
+        m_current = (ev.key.m_ts / m_width) % m_buckets.size();
+        return ev;
+    }
+
+    void Remove(const Event& ev) override
+    {
+        if (ev.key.m_ts - m_windowStart < m_width * m_buckets.size())
+        {
+            std::size_t b = (ev.key.m_ts / m_width) % m_buckets.size();
+            std::vector<Event>& bucket = m_buckets[b];
+            auto it = std::find_if(bucket.begin(), bucket.end(), [&ev](const Event& e) {
+                return e.key.m_uid == ev.key.m_uid;
+            });
+            if (it != bucket.end())
+            {
+                *it = bucket.back();
+                bucket.pop_back();
+                --m_count;
+                if (b == m_next)
+                {
+                    if (!bucket.empty())
+                    {
+                        std::make_heap(bucket.begin(), bucket.end(), &IsLater);
+                    }
+                    else if (m_count > 0)
+                    {
+                        AdvanceNext();
+                    }
+                }
+                return;
+            }
+        }
+        // an event inserted before the window reached it                                               윈도우가 도달하기 전에 삽입된 이벤트
+        std::size_t erased = m_far.erase(ev.key);
+        NS_ASSERT(erased == 1);
+    }
+
+  private:
+    /**
+     * Order of the heap of the head bucket, whose front is the earliest event.                         가장 이른 이벤트가 앞에 오는 헤드 버킷 힙의 순서
+     *
+     * \param a an event                                                                                이벤트
+     * \param b another event                                                                           다른 이벤트
+     * \return true if a is after b                                                                     a가 b보다 뒤이면 참
+     */
+    static bool IsLater(const Event& a, const Event& b)
+    {
+        return b < a;
+    }
+
+    /**
+     * \param b a bucket index                                                                          버킷 인덱스
+     * \return the position of the bucket in the window, from the current one                           현재 버킷부터 센 윈도우 안의 버킷 위치
+     */
+    std::size_t Offset(std::size_t b) const
+    {
+        return (b + m_buckets.size() - m_current) % m_buckets.size();
+    }
+
+    /// Move m_next to the following non-empty bucket and make it a heap                                m_next를 다음 비어 있지 않은 버킷으로 옮기고 힙으로 만듭니다
+    void AdvanceNext()
+    {
+        do
+        {
+            m_next = (m_next + 1) % m_buckets.size();
+        } while (m_buckets[m_next].empty());
+        std::make_heap(m_buckets[m_next].begin(), m_buckets[m_next].end(), &IsLater);
+    }
+
+    uint64_t m_width{1};                       ///< bucket width [time steps]
+    std::vector<std::vector<Event>> m_buckets; ///< the calendar, the head bucket being a heap
+    uint64_t m_windowStart{0};                 ///< start of the current bucket [time steps]
+    std::size_t m_current{0};                  ///< bucket of the current time
+    std::size_t m_next{0};                     ///< first non-empty bucket, when m_count > 0
+    std::size_t m_count{0};                    ///< number of events in the buckets
+    std::map<EventKey, EventImpl*> m_far;      ///< events beyond the calendar window
+};
+
+NS_OBJECT_ENSURE_REGISTERED(SubframeCalendarScheduler);
+
+} // namespace ns3
+
+#endif // LENA_SUBFRAME_CALENDAR_SCHEDULER_H
@@ -0,0 +1,560 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef LENA_SUBSYSTEM_PROFILER_H
+#define LENA_SUBSYSTEM_PROFILER_H
+
+#include <ns3/abort.h>
+#include <ns3/component-carrier-enb.h>
+#include <ns3/event-impl.h>
+#include <ns3/ff-mac-sched-sap.h>
+#include <ns3/ff-mac-scheduler.h>
+#include <ns3/lte-enb-mac.h>
+#include <ns3/lte-enb-net-device.h>
+#include <ns3/map-scheduler.h>
+#include <ns3/net-device-container.h>
+#include <ns3/object-factory.h>
+#include <ns3/propagation-loss-model.h>
+#include <ns3/scheduler.h>
+#include <ns3/simulator.h>
+#include <ns3/spectrum-channel.h>
+#include <ns3/type-id.h>
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <map>
+#include <memory>
+#include <regex>
+#include <string>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
+#include <vector>
+
+#if defined(__GNUC__)
+#include <cxxabi.h>
+#endif
+
+namespace ns3
+{
+
+/**
+ * Wall-clock time spent by the LTE subsystems during a simulation.                                     시뮬레이션 동안 LTE 서브시스템이 사용한 실제 시간
+ *
+ * Two kinds of measurements are collected:                                                             두 종류의 측정값을 수집합니다.
+ * - the time of every event, charged to the subsystem of the class owning the                          - 모든 이벤트의 시간을 이벤트가 호출하는 멤버 함수를 가진 클래스의
+ *   member function the event calls (PHY, MAC, RLC, PDCP/RRC or other), found                          서브시스템에 부과합니다(PHY, MAC, RLC, PDCP/RRC 또는 기타). 서브시스템은
+ *   from the TypeId of that class (see Classify()).                                                    그 클래스의 TypeId에서 찾습니다(Classify() 참조).
+ *   Work done synchronously by another layer is charged to the caller: e.g.,                           다른 계층이 동기적으로 수행한 작업은 호출자에게 부과됩니다. 예: 전송 기회에
+ *   the RLC PDUs built on a transmission opportunity are charged to the MAC;                           만들어지는 RLC PDU는 MAC에 부과됩니다.
+ * - the time spent in the MAC schedulers and in the pathloss models, measured                          - MAC 스케줄러와 경로 손실 모델에서 사용한 시간을 호출 주위에서 측정합니다.
+ *   around their calls. The scheduler time is also part of the MAC events and                          스케줄러 시간은 MAC 이벤트에도, 경로 손실 시간은 PHY 이벤트에도
+ *   the pathloss time of the PHY events.                                                               포함됩니다.
+ *
+ * The event times are collected by the EventProfilingScheduler, to be set with                         이벤트 시간은 Simulator::SetScheduler()로 설정할 EventProfilingScheduler가
+ * Simulator::SetScheduler(); the scheduler and pathloss times by the wrappers                          수집합니다. 스케줄러와 경로 손실 시간은 InstrumentSchedulers()와
+ * installed by InstrumentSchedulers() and InstrumentPathloss().                                        InstrumentPathloss()가 설치하는 래퍼가 수집합니다.
+ */
+class SubsystemProfile
+{
+  public:
+    /// Subsystem charged for an event                                                                  이벤트가 부과되는 서브시스템
+    enum Subsystem
+    {
+        PHY,
+        MAC,
+        RLC,
+        PDCP_RRC,
+        OTHER,
+        NUM_SUBSYSTEMS
+    };
+
+    /// Clock used for the measurements                                                                 측정에 사용하는 시계
+    typedef std::chrono::steady_clock Clock;
+
+    /**
+     * \return the profile of this process                                                              이 프로세스의 프로파일
+     */
+    static SubsystemProfile& Get()
+    {
+        static SubsystemProfile profile;
+        return profile;
+    }
+
+    /**
+     * \param subsystem the subsystem                                                                   서브시스템
+     * \return the name of the subsystem                                                                서브시스템의 이름
+     */
+    static std::string GetName(Subsystem subsystem)
+    {
+        static const std::array<std::string, NUM_SUBSYSTEMS> names{"phy",
+                                                                   "mac",
+                                                                   "rlc",
+                                                                   "pdcpRrc",
+                                                                   "other"};
+        return names[subsystem];
+    }
+
+    /**
+     * \param subsystem the subsystem                                                                   서브시스템
+     * \return the time of the events of the subsystem [s]                                              서브시스템 이벤트의 시간 [s]
+     */
+    double GetEventTime(Subsystem subsystem) const
+    {
+        return std::chrono::duration<double>(m_eventTime[subsystem]).count();
+    }
+
+    /**
+     * \return the time spent in the MAC schedulers [s]                                                 MAC 스케줄러에서 사용한 시간 [s]
+     */
+    double GetSchedulerTime() const
+    {
+        return std::chrono::duration<double>(m_schedulerTime).count();
+    }
+
+    /**
+     * \return the time spent in the pathloss models [s]                                                경로 손실 모델에서 사용한 시간 [s]
+     */
+    double GetPathlossTime() const
+    {
+        return std::chrono::duration<double>(m_pathlossTime).count();
+    }
+
+    /**
+     * Start charging the time to the subsystem of an event.                                            이벤트의 서브시스템에 시간 부과를 시작합니다.
+     *
+     * The time elapsed since the previous call is charged to the previous event.                       이전 호출 이후 경과한 시간은 이전 이벤트에 부과됩니다.
+     *
+     * \param event the event about to be executed, or nullptr when there is none                       실행될 이벤트, 없으면 nullptr
+     */
+    void StartEvent(const EventImpl* event)
+    {
+        Clock::time_point now = Clock::now();
+        if (m_current != NUM_SUBSYSTEMS)
+        {
+            m_eventTime[m_current] += now - m_eventStart;
+        }
+        m_current = event ? Classify(*event) : NUM_SUBSYSTEMS;
+        m_eventStart = now;
+    }
+
+    /**
+     * \param duration time spent in a MAC scheduler                                                    MAC 스케줄러에서 사용한 시간
+     */
+    void AddSchedulerTime(Clock::duration duration)
+    {
+        m_schedulerTime += duration;
+    }
+
+    /**
+     * \param duration time spent in a pathloss model                                                   경로 손실 모델에서 사용한 시간
+     */
+    void AddPathlossTime(Clock::duration duration)
+    {
+        m_pathlossTime += duration;
+    }
+
+  private:
+    SubsystemProfile()
+    {
+        m_eventTime.fill(Clock::duration::zero());
+    }
+
+    /**
+     * Find the subsystem of an event from the class owning the member function it                      이벤트가 호출하는 멤버 함수를 가진 클래스에서 이벤트의 서브시스템을
+     * calls. The class is read from the pointer to member type of the event; the                       찾습니다. 클래스는 이벤트의 멤버 포인터 타입에서 읽으며, 그 TypeId와
+     * owner TypeId and its parents are then looked up in the table of GetOwners(),                     부모 TypeId들을 GetOwners()의 표에서 찾습니다. TypeId가 없는 클래스
+     * as is the class name itself for the classes without a TypeId (SAPs). Events                      (SAP)는 클래스 이름 자체를 찾습니다. 멤버 함수를 호출하지 않거나 표에
+     * not calling a member function, or of a class missing from the table, are                         없는 클래스의 이벤트는 OTHER로 부과됩니다.
+     * charged to OTHER.
+     *
+     * \param event the event                                                                           이벤트
+     * \return the subsystem                                                                            서브시스템
+     */
+    Subsystem Classify(const EventImpl& event)
+    {
+        std::type_index type(typeid(event));
+        auto it = m_subsystems.find(type);
+        if (it != m_subsystems.end())
+        {
+            return it->second;
+        }
+        std::string owner = GetOwner(type);
+        Subsystem subsystem = OTHER;
+        TypeId tid;
+        if (TypeId::LookupByNameFailSafe(owner, &tid))
+        {
+            while (GetOwners().count(tid.GetName()) == 0 && tid.HasParent())
+            {
+                tid = tid.GetParent();
+            }
+            owner = tid.GetName();
+        }
+        auto found = GetOwners().find(owner);
+        if (found != GetOwners().end())
+        {
+            subsystem = found->second;
+        }
+        m_subsystems.emplace(type, subsystem);
+        return subsystem;
+    }
+
+    /**
+     * \return the subsystem of the classes owning the LTE events, a class being                        LTE 이벤트를 가진 클래스의 서브시스템. 클래스는 자신 또는 부모가
+     *         charged to the subsystem of itself or of its closest listed parent                       나열된 가장 가까운 서브시스템에 부과됩니다
+     */
+    static const std::map<std::string, Subsystem>& GetOwners()
+    {
+        static const std::map<std::string, Subsystem> owners{
+            {"ns3::LtePhy", PHY},
+            {"ns3::LteSpectrumPhy", PHY},
+            {"ns3::SpectrumChannel", PHY},
+            {"ns3::LteEnbMac", MAC},
+            {"ns3::LteUeMac", MAC},
+            {"ns3::FfMacScheduler", MAC},
+            {"ns3::LteRlc", RLC},
+            {"ns3::LtePdcp", PDCP_RRC},
+            {"ns3::LteEnbRrc", PDCP_RRC},
+            {"ns3::UeManager", PDCP_RRC},
+            {"ns3::LteUeRrc", PDCP_RRC},
+            {"ns3::LteEnbRrcProtocolIdeal", PDCP_RRC},
+            {"ns3::LteUeRrcProtocolIdeal", PDCP_RRC},
+            {"ns3::LteEnbRrcProtocolReal", PDCP_RRC},
+            {"ns3::LteUeRrcProtocolReal", PDCP_RRC},
+            {"ns3::LteEnbRrcSapProvider", PDCP_RRC},
+            {"ns3::LteUeRrcSapProvider", PDCP_RRC},
+        };
+        return owners;
+    }
+
+    /**
+     * Read the class owning the member function called by the events of a type,                        한 타입의 이벤트가 호출하는 멤버 함수를 가진 클래스를 읽습니다.
+     * from the "void (ns3::LteEnbPhy::*)()" part of the type name demangled as                         "void (ns3::LteEnbPhy::*)()"처럼 디맹글된 타입 이름 부분에서 읽으며,
+     * by the Itanium C++ ABI (GCC, Clang), like in CallbackImplBase::Demangle().                       CallbackImplBase::Demangle()처럼 Itanium C++ ABI(GCC, Clang)를 따릅니다.
+     *
+     * \param type the type of the events                                                               이벤트의 타입
+     * \return the class name, or an empty string when there is none                                    클래스 이름, 없으면 빈 문자열
+     */
+    static std::string GetOwner(std::type_index type)
+    {
+        std::string name = type.name();
+#if defined(__GNUC__)
+        int status = 0;
+        char* demangled = abi::__cxa_demangle(name.c_str(), nullptr, nullptr, &status);
+        if (status == 0)
+        {
+            name = demangled;
+        }
+        std::free(demangled);
+#endif
+        static const std::regex memberPointer(R"(\(([^() ]+)::\*\))");
+        std::smatch match;
+        return std::regex_search(name, match, memberPointer) ? match[1].str() : std::string();
+    }
+
+    std::array<Clock::duration, NUM_SUBSYSTEMS> m_eventTime;  ///< time of the events per subsystem
+    Clock::duration m_schedulerTime{Clock::duration::zero()}; ///< time in the MAC schedulers
+    Clock::duration m_pathlossTime{Clock::duration::zero()};  ///< time in the pathloss models
+    Subsystem m_current{NUM_SUBSYSTEMS};                      ///< subsystem of the current event
+    Clock::time_point m_eventStart;                           ///< start of the current event
+    /// subsystem per event type
+    std::unordered_map<std::type_index, Subsystem> m_subsystems;
+};
+
+/**
+ * Scheduler that reports every event it hands to the simulator to the                                  시뮬레이터에 넘기는 모든 이벤트를 SubsystemProfile에 알리는 스케줄러
+ * SubsystemProfile: the time between two RemoveNext() calls is the time of                             두 RemoveNext() 호출 사이의 시간이 이전 이벤트의 시간입니다.
+ * the previous event. SubsystemProfile::Get().StartEvent(nullptr) must be called                       마지막 이벤트를 부과하려면 Simulator::Run() 후에
+ * after Simulator::Run() to charge the last event. The events are kept by the                          SubsystemProfile::Get().StartEvent(nullptr)를 호출해야 합니다. 이벤트는
+ * scheduler of the Scheduler attribute, a MapScheduler by default.                                     Scheduler 속성의 스케줄러(기본값은 MapScheduler)가 보관합니다.
+ */
+class EventProfilingScheduler : public Scheduler
+{
+  public:
+    /**
+     * \brief Get the type ID.                                                                          타입 ID를 가져옵니다.
+     * \return the object TypeId                                                                        객체 TypeId
+     */
+    static TypeId GetTypeId()
+    {
+        static TypeId tid =
+            TypeId("ns3::EventProfilingScheduler")
+                .SetParent<Scheduler>()
+                .SetGroupName("Lte")
+                .AddConstructor<EventProfilingScheduler>()
+                .AddAttribute("Scheduler",
+                              "Type of the scheduler keeping the events",
+                              TypeIdValue(MapScheduler::GetTypeId()),
+                              MakeTypeIdAccessor(&EventProfilingScheduler::SetScheduler),
+                              MakeTypeIdChecker());
+        return tid;
+    }
+
+    /**
+     * Set the type of the scheduler keeping the events.                                                이벤트를 보관하는 스케줄러의 타입을 설정합니다.
+     *
+     * \param tid the scheduler TypeId                                                                  스케줄러 TypeId
+     */
+    void SetScheduler(TypeId tid)
+    {
+        NS_ABORT_MSG_IF(m_scheduler && !m_scheduler->IsEmpty(),
+                        "the scheduler can't change with events scheduled");
+        ObjectFactory factory;
+        factory.SetTypeId(tid);
+        m_scheduler = factory.Create<Scheduler>();
+    }
+
+    void Insert(const Event& ev) override
+    {
+        m_scheduler->Insert(ev);
+    }
+
+    bool IsEmpty() const override
+    {
+        return m_scheduler->IsEmpty();
+    }
+
+    Event PeekNext() const override
+    {
+        return m_scheduler->PeekNext();
+    }
+
+    Event RemoveNext() override
+    {
+        Event event = m_scheduler->RemoveNext();
+        SubsystemProfile::Get().StartEvent(event.impl);
+        return event;
+    }
+
+    void Remove(const Event& ev) override
+    {
+        m_scheduler->Remove(ev);
+    }
+
+  private:
+    Ptr<Scheduler> m_scheduler; ///< scheduler keeping the events
+};
+
+NS_OBJECT_ENSURE_REGISTERED(EventProfilingScheduler);
+
+/**
+ * FfMacSchedSapProvider measuring the time spent in the scheduler it forwards to.                      전달 대상 스케줄러에서 사용한 시간을 측정하는 FfMacSchedSapProvider
+ */
+class TimedFfMacSchedSapProvider : public FfMacSchedSapProvider
+{
+  public:
+    /**
+     * \param provider the SAP provider of the scheduler                                                스케줄러의 SAP 제공자
+     */
+    TimedFfMacSchedSapProvider(FfMacSchedSapProvider* provider)
+        : m_provider(provider)
+    {
+    }
+
+    void SchedDlRlcBufferReq(const SchedDlRlcBufferReqParameters& params) override
+    {
+        Timer timer;
+        m_provider->SchedDlRlcBufferReq(params);
+    }
+
+    void SchedDlPagingBufferReq(const SchedDlPagingBufferReqParameters& params) override
+    {
+        Timer timer;
+        m_provider->SchedDlPagingBufferReq(params);
+    }
+
+    void SchedDlMacBufferReq(const SchedDlMacBufferReqParameters& params) override
+    {
+        Timer timer;
+        m_provider->SchedDlMacBufferReq(params);
+    }
+
+    void SchedDlTriggerReq(const SchedDlTriggerReqParameters& params) override
+    {
+        Timer timer;
+        m_provider->SchedDlTriggerReq(params);
+    }
+
+    void SchedDlRachInfoReq(const SchedDlRachInfoReqParameters& params) override
+    {
+        Timer timer;
+        m_provider->SchedDlRachInfoReq(params);
+    }
+
+    void SchedDlCqiInfoReq(const SchedDlCqiInfoReqParameters& params) override
+    {
+        Timer timer;
+        m_provider->SchedDlCqiInfoReq(params);
+    }
+
+    void SchedUlTriggerReq(const SchedUlTriggerReqParameters& params) override
+    {
+        Timer timer;
+        m_provider->SchedUlTriggerReq(params);
+    }
+
+    void SchedUlNoiseInterferenceReq(const SchedUlNoiseInterferenceReqParameters& params) override
+    {
+        Timer timer;
+        m_provider->SchedUlNoiseInterferenceReq(params);
+    }
+
+    void SchedUlSrInfoReq(const SchedUlSrInfoReqParameters& params) override
+    {
+        Timer timer;
+        m_provider->SchedUlSrInfoReq(params);
+    }
+
+    void SchedUlMacCtrlInfoReq(const SchedUlMacCtrlInfoReqParameters& params) override
+    {
+        Timer timer;
+        m_provider->SchedUlMacCtrlInfoReq(params);
+    }
+
+    void SchedUlCqiInfoReq(const SchedUlCqiInfoReqParameters& params) override
+    {
+        Timer timer;
+        m_provider->SchedUlCqiInfoReq(params);
+    }
+
+  private:
+    /// Charges its lifetime to the scheduler time                                                      자신의 수명을 스케줄러 시간에 부과합니다.
+    struct Timer
+    {
+        Timer()
+            : start(SubsystemProfile::Clock::now())
+        {
+        }
+
+        ~Timer()
+        {
+            SubsystemProfile::Get().AddSchedulerTime(SubsystemProfile::Clock::now() - start);
+        }
+
+        SubsystemProfile::Clock::time_point start; ///< start of the call
+    };
+
+    FfMacSchedSapProvider* m_provider; ///< SAP provider of the scheduler
+};
+
+/**
+ * Pathloss model used in pairs around the pathloss models of a channel: the                            채널의 경로 손실 모델 앞뒤에 쌍으로 사용하는 경로 손실 모델:
+ * first one of the chain records the start of the computation and the last one                         체인의 첫 번째는 계산 시작을 기록하고, 마지막은 경과 시간을
+ * charges the elapsed time to the pathloss time. Neither changes the power.                            경로 손실 시간에 부과합니다. 둘 다 전력을 바꾸지 않습니다.
+ */
+class PathlossTimer : public PropagationLossModel
+{
+  public:
+    /**
+     * \brief Get the type ID.                                                                          타입 ID를 가져옵니다.
+     * \return the object TypeId                                                                        객체 TypeId
+     */
+    static TypeId GetTypeId()
+    {
+        static TypeId tid = TypeId("ns3::PathlossTimer")
+                                .SetParent<PropagationLossModel>()
+                                .SetGroupName("Lte")
+                                .AddConstructor<PathlossTimer>();
+        return tid;
+    }
+
+    /**
+     * \param start the timer at the head of the chain, or nullptr for this one                         체인 앞쪽의 타이머, 이 타이머가 앞쪽이면 nullptr
+     */
+    void SetStart(Ptr<PathlossTimer> start)
+    {
+        m_start = start;
+    }
+
+  private:
+    double DoCalcRxPower(double txPowerDbm,
+                         Ptr<MobilityModel> a,
+                         Ptr<MobilityModel> b) const override
+    {
+        if (m_start)
+        {
+            SubsystemProfile::Get().AddPathlossTime(SubsystemProfile::Clock::now() -
+                                                    m_start->m_startTime);
+        }
+        else
+        {
+            m_startTime = SubsystemProfile::Clock::now();
+        }
+        return txPowerDbm;
+    }
+
+    int64_t DoAssignStreams(int64_t stream) override
+    {
+        return 0;
+    }
+
+    Ptr<PathlossTimer> m_start;                              ///< timer at the head of the chain
+    mutable SubsystemProfile::Clock::time_point m_startTime; ///< start of the computation
+};
+
+NS_OBJECT_ENSURE_REGISTERED(PathlossTimer);
+
+/**
+ * Measure the time spent in the MAC schedulers of a set of eNBs.                                       eNB 집합의 MAC 스케줄러에서 사용한 시간을 측정합니다.
+ *
+ * \param enbDevs the eNB devices                                                                       eNB 장치
+ * \param providers the wrappers, to be kept until the end of the simulation                            시뮬레이션 끝까지 유지해야 하는 래퍼
+ */
+inline void
+InstrumentSchedulers(NetDeviceContainer enbDevs,
+                     std::vector<std::unique_ptr<TimedFfMacSchedSapProvider>>& providers)
+{
+    for (auto it = enbDevs.Begin(); it != enbDevs.End(); ++it)
+    {
+        Ptr<LteEnbNetDevice> enbDev = (*it)->GetObject<LteEnbNetDevice>();
+        for (const auto& cc : enbDev->GetCcMap())
+        {
+            Ptr<ComponentCarrierEnb> ccEnb = DynamicCast<ComponentCarrierEnb>(cc.second);
+            providers.emplace_back(std::make_unique<TimedFfMacSchedSapProvider>(
+                ccEnb->GetFfMacScheduler()->GetFfMacSchedSapProvider()));
+            ccEnb->GetMac()->SetFfMacSchedSapProvider(providers.back().get());
+        }
+    }
+}
+
+/**
+ * Measure the time spent in the pathloss models of a channel.                                          채널의 경로 손실 모델에서 사용한 시간을 측정합니다.
+ *
+ * \param channel the channel                                                                           채널
+ */
+inline void
+InstrumentPathloss(Ptr<SpectrumChannel> channel)
+{
+    Ptr<PropagationLossModel> last = channel->GetPropagationLossModel();
+    if (!last)
+    {
+        return;
+    }
+    while (last->GetNext())
+    {
+        last = last->GetNext();
+    }
+    Ptr<PathlossTimer> start = CreateObject<PathlossTimer>();
+    Ptr<PathlossTimer> stop = CreateObject<PathlossTimer>();
+    stop->SetStart(start);
+    last->SetNext(stop);
+    channel->AddPropagationLossModel(start);
+}
+
+} // namespace ns3
+
+#endif // LENA_SUBSYSTEM_PROFILER_H
@@ -0,0 +1,179 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef LENA_THROUGHPUT_BINNER_H
+#define LENA_THROUGHPUT_BINNER_H
+
+#include <ns3/abort.h>
+#include <ns3/address.h>
+#include <ns3/nstime.h>
+#include <ns3/packet-sink.h>
+#include <ns3/packet.h>
+#include <ns3/simulator.h>
+
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * Throughput of a set of flows, binned over fixed intervals and written to one file.                   여러 흐름의 throughput을 고정 구간으로 나누어 하나의 파일에 기록합니다.
+ *
+ * Each flow is identified by an IMSI and a bearer ID and gets a slot in a flat array                   각 흐름은 IMSI와 베어러 ID로 식별되며, 바이트 카운터 평면 배열의 한 칸을
+ * of byte counters; the receive callback only adds to its slot. A single event per                     차지합니다. 수신 콜백은 자신의 칸에 더하기만 합니다. 흐름 수와 관계없이
+ * bin, whatever the number of flows, writes one line to the output file, kept open                     구간마다 하나의 이벤트가 출력 파일(실행 내내 열려 있음)에 한 줄을 기록합니다:
+ * for the whole run: the time, then the throughput of every flow in the order they                     시간, 그리고 흐름이 추가된 순서대로 각 흐름의 throughput [Mbit/s, 1 Mbit = 1024 * 1024 bit]
+ * were added [Mbit/s, with 1 Mbit = 1024 * 1024 bit]. With one flow, the file has
+ * the "time throughput" layout of lena-radio-link-failure.
+ *
+ * Scheduled events and callbacks refer to the binner, which must outlive                               예약된 이벤트와 콜백이 이 객체를 참조하므로, Simulator::Run()보다 오래
+ * Simulator::Run(); Close() (or the destructor) flushes the file.                                      살아 있어야 합니다. Close() (또는 소멸자)가 파일을 flush합니다.
+ */
+class ThroughputBinner
+{
+  public:
+    /**
+     * \param fileName the output file name                                                             출력 파일 이름
+     * \param binSize the bin size                                                                      구간 크기
+     */
+    ThroughputBinner(std::string fileName, Time binSize)
+        : m_fileName(fileName),
+          m_binSize(binSize)
+    {
+        NS_ABORT_MSG_IF(!binSize.IsStrictlyPositive(), "the bin size must be positive");
+    }
+
+    ~ThroughputBinner()
+    {
+        Close();
+    }
+
+    ThroughputBinner(const ThroughputBinner&) = delete;
+    ThroughputBinner& operator=(const ThroughputBinner&) = delete;
+
+    /**
+     * Add a flow.                                                                                      흐름을 추가합니다.
+     *
+     * \param imsi the IMSI of the UE                                                                   UE의 IMSI
+     * \param bearerId the bearer ID, e.g., the EPS bearer ID                                           베어러 ID (예: EPS 베어러 ID)
+     * \return the index of the flow, to be passed to AddBytes()                                        AddBytes()에 전달할 흐름의 인덱스
+     */
+    uint32_t AddFlow(uint64_t imsi, uint8_t bearerId)
+    {
+        NS_ABORT_MSG_IF(m_output.is_open(), "flows must be added before Start()");
+        uint32_t flow = m_bytes.size();
+        bool inserted = m_flows.emplace(std::make_pair(imsi, bearerId), flow).second;
+        NS_ABORT_MSG_IF(!inserted,
+                        "flow of IMSI " << imsi << " bearer " << +bearerId << " added twice");
+        m_bytes.push_back(0);
+        return flow;
+    }
+
+    /**
+     * Add a flow and count the packets received by a PacketSink for it.                                흐름을 추가하고 PacketSink가 수신한 패킷을 그 흐름으로 셉니다.
+     *
+     * \param sink the packet sink                                                                      패킷 싱크
+     * \param imsi the IMSI of the UE                                                                   UE의 IMSI
+     * \param bearerId the bearer ID, e.g., the EPS bearer ID                                           베어러 ID (예: EPS 베어러 ID)
+     */
+    void ConnectPacketSink(Ptr<PacketSink> sink, uint64_t imsi, uint8_t bearerId)
+    {
+        uint32_t flow = AddFlow(imsi, bearerId);
+        sink->TraceConnectWithoutContext("Rx",
+                                         MakeBoundCallback(&ThroughputBinner::Rx, this, flow));
+    }
+
+    /**
+     * Count bytes received by a flow.                                                                  흐름이 수신한 바이트를 셉니다.
+     *
+     * \param flow the index returned by AddFlow()                                                      AddFlow()가 반환한 인덱스
+     * \param bytes the number of bytes                                                                 바이트 수
+     */
+    void AddBytes(uint32_t flow, uint32_t bytes)
+    {
+        m_bytes[flow] += bytes;
+    }
+
+    /**
+     * Open the output file and schedule the first bin.                                                 출력 파일을 열고 첫 번째 구간을 예약합니다.
+     *
+     * \param firstBin the time the first bin is written, covering the bytes                            첫 번째 구간이 기록되는 시간 (그때까지 수신된 바이트를 포함)
+     *                 received until then
+     */
+    void Start(Time firstBin)
+    {
+        NS_ABORT_MSG_IF(m_output.is_open(), "already started");
+        m_output.open(m_fileName, std::ofstream::out);
+        NS_ABORT_MSG_IF(!m_output.is_open(), "Can't open file " << m_fileName);
+        Simulator::Schedule(firstBin, &ThroughputBinner::WriteBin, this);
+    }
+
+    /// Flush and close the output file                                                                 출력 파일을 flush하고 닫습니다.
+    void Close()
+    {
+        if (m_output.is_open())
+        {
+            m_output.close();
+        }
+    }
+
+  private:
+    /**
+     * Sink of the Rx trace of a PacketSink.                                                            PacketSink의 Rx 트레이스 싱크
+     *
+     * \param binner the ThroughputBinner                                                               ThroughputBinner 객체
+     * \param flow the index of the flow                                                                흐름의 인덱스
+     * \param packet the received packet                                                                수신된 패킷
+     */
+    static void Rx(ThroughputBinner* binner,
+                   uint32_t flow,
+                   Ptr<const Packet> packet,
+                   const Address&)
+    {
+        binner->m_bytes[flow] += packet->GetSize();
+    }
+
+    /// Write the current bin and schedule the next one                                                 현재 구간을 기록하고 다음 구간을 예약합니다.
+    void WriteBin()
+    {
+        if (!m_output.is_open())
+        {
+            return;
+        }
+        m_output << Simulator::Now().As(Time::S);
+        for (auto& bytes : m_bytes)
+        {
+            m_output << " " << bytes * 8 / m_binSize.GetSeconds() / 1024 / 1024;
+            bytes = 0;
+        }
+        m_output << "\n";
+        Simulator::Schedule(m_binSize, &ThroughputBinner::WriteBin, this);
+    }
+
+    std::string m_fileName;                                   ///< output file name
+    Time m_binSize;                                           ///< bin size
+    std::ofstream m_output;                                   ///< output file
+    std::vector<uint64_t> m_bytes;                            ///< bytes of the current bin
+    std::map<std::pair<uint64_t, uint8_t>, uint32_t> m_flows; ///< flow index per (IMSI, bearer ID)
+};
+
+} // namespace ns3
+
+#endif // LENA_THROUGHPUT_BINNER_H
@@ -17,6 +17,8 @@
  * Author: Manuel Requena <manuel.requena@cttc.es>
  */
 
+#include "lena-lte-trace-connector.h"
+
 #include "ns3/applications-module.h"
 #include "ns3/core-module.h"
 #include "ns3/internet-module.h"
@@ -311,18 +313,13 @@ main(int argc, char* argv[])
     pdcpStats->SetAttribute("EpochDuration", TimeValue(Seconds(1.0)));
 
     // connect custom trace sinks for RRC connection establishment and handover notification            RRC 연결 설정 및 핸드오버 알림을 위한 사용자 정의 트레이스 싱크 연결
-    Config::Connect("/NodeList/*/DeviceList/*/LteEnbRrc/ConnectionEstablished",
-                    MakeCallback(&NotifyConnectionEstablishedEnb));
-    Config::Connect("/NodeList/*/DeviceList/*/LteUeRrc/ConnectionEstablished",
-                    MakeCallback(&NotifyConnectionEstablishedUe));
-    Config::Connect("/NodeList/*/DeviceList/*/LteEnbRrc/HandoverStart",
-                    MakeCallback(&NotifyHandoverStartEnb));
-    Config::Connect("/NodeList/*/DeviceList/*/LteUeRrc/HandoverStart",
-                    MakeCallback(&NotifyHandoverStartUe));
-    Config::Connect("/NodeList/*/DeviceList/*/LteEnbRrc/HandoverEndOk",
-                    MakeCallback(&NotifyHandoverEndOkEnb));
-    Config::Connect("/NodeList/*/DeviceList/*/LteUeRrc/HandoverEndOk",
-                    MakeCallback(&NotifyHandoverEndOkUe));
+    LteTraceConnector traces;
+    traces.ConnectEnbRrc("ConnectionEstablished", MakeCallback(&NotifyConnectionEstablishedEnb));
+    traces.ConnectUeRrc("ConnectionEstablished", MakeCallback(&NotifyConnectionEstablishedUe));
+    traces.ConnectEnbRrc("HandoverStart", MakeCallback(&NotifyHandoverStartEnb));
+    traces.ConnectUeRrc("HandoverStart", MakeCallback(&NotifyHandoverStartUe));
+    traces.ConnectEnbRrc("HandoverEndOk", MakeCallback(&NotifyHandoverEndOkEnb));
+    traces.ConnectUeRrc("HandoverEndOk", MakeCallback(&NotifyHandoverEndOkUe));
 
     Simulator::Stop(Seconds(simTime));
     Simulator::Run();
@@ -17,6 +17,9 @@
  * Author: Manuel Requena <manuel.requena@cttc.es>
  */
 
+#include "lena-lte-binary-traces.h"
+#include "lena-lte-trace-connector.h"
+
 #include "ns3/applications-module.h"
 #include "ns3/core-module.h"
 #include "ns3/internet-module.h"
@@ -178,6 +181,7 @@ main(int argc, char* argv[])
     double distance = 100.0;                                                                            // eNB 사이의 거리
     bool disableDl = false;                                                                             // 다운링크 데이터 흐름 비활성화 여부
     bool disableUl = false;                                                                             // 업링크 데이터 흐름 비활성화 여부
+    std::string traceFormat = "text";                                                                   // MAC/RLC/PDCP 트레이스 형식
 
     // change some default attributes so that they are reasonable for                                   시나리오에 맞는 기본 속성 변경
     // this scenario, but do this before processing command line
@@ -193,7 +197,12 @@ main(int argc, char* argv[])
     cmd.AddValue("simTime", "Total duration of the simulation", simTime);                               // 시뮬레이션 총 시간
     cmd.AddValue("disableDl", "Disable downlink data flows", disableDl);                                // 다운링크 데이터 흐름 비활성화
     cmd.AddValue("disableUl", "Disable uplink data flows", disableUl);                                  // 업링크 데이터 흐름 비활성화
+    cmd.AddValue("traceFormat",                                                                         // MAC/RLC/PDCP 트레이스 형식: text 또는 binary
+                 "Format of the MAC/RLC/PDCP traces: text (LteHelper) or binary (LteBinaryTraces)",
+                 traceFormat);
     cmd.Parse(argc, argv);
+    NS_ABORT_MSG_IF(traceFormat != "text" && traceFormat != "binary",
+                    "traceFormat must be text or binary");
 
     Ptr<LteHelper> lteHelper = CreateObject<LteHelper>();
     Ptr<PointToPointEpcHelper> epcHelper = CreateObject<PointToPointEpcHelper>();
@@ -351,40 +360,42 @@ main(int argc, char* argv[])
     // p2ph.EnablePcapAll("lena-x2-handover");
 
     lteHelper->EnablePhyTraces();
-    lteHelper->EnableMacTraces();
-    lteHelper->EnableRlcTraces();
-    lteHelper->EnablePdcpTraces();
-    Ptr<RadioBearerStatsCalculator> rlcStats = lteHelper->GetRlcStats();
-    rlcStats->SetAttribute("EpochDuration", TimeValue(Seconds(0.05)));
-    Ptr<RadioBearerStatsCalculator> pdcpStats = lteHelper->GetPdcpStats();
-    pdcpStats->SetAttribute("EpochDuration", TimeValue(Seconds(0.05)));
+    LteBinaryTraces binaryTraces;
+    if (traceFormat == "binary")
+    {
+        // lena-lte-trace-converter rebuilds the stats files with the same epochs                       같은 에포크로 통계 파일을 다시 만듭니다.
+        binaryTraces.SetEpoch(Seconds(0), Seconds(0.05));
+        binaryTraces.EnableTraces();
+    }
+    else
+    {
+        lteHelper->EnableMacTraces();
+        lteHelper->EnableRlcTraces();
+        lteHelper->EnablePdcpTraces();
+        Ptr<RadioBearerStatsCalculator> rlcStats = lteHelper->GetRlcStats();
+        rlcStats->SetAttribute("EpochDuration", TimeValue(Seconds(0.05)));
+        Ptr<RadioBearerStatsCalculator> pdcpStats = lteHelper->GetPdcpStats();
+        pdcpStats->SetAttribute("EpochDuration", TimeValue(Seconds(0.05)));
+    }
 
     // connect custom trace sinks for RRC connection establishment and handover notification            RRC 연결 설정 및 핸드오버 알림에 사용자 정의 트레이스 싱크 연결
-    Config::Connect("/NodeList/*/DeviceList/*/LteEnbRrc/ConnectionEstablished",
-                    MakeCallback(&NotifyConnectionEstablishedEnb));
-    Config::Connect("/NodeList/*/DeviceList/*/LteUeRrc/ConnectionEstablished",
-                    MakeCallback(&NotifyConnectionEstablishedUe));
-    Config::Connect("/NodeList/*/DeviceList/*/LteEnbRrc/HandoverStart",
-                    MakeCallback(&NotifyHandoverStartEnb));
-    Config::Connect("/NodeList/*/DeviceList/*/LteUeRrc/HandoverStart",
-                    MakeCallback(&NotifyHandoverStartUe));
-    Config::Connect("/NodeList/*/DeviceList/*/LteEnbRrc/HandoverEndOk",
-                    MakeCallback(&NotifyHandoverEndOkEnb));
-    Config::Connect("/NodeList/*/DeviceList/*/LteUeRrc/HandoverEndOk",
-                    MakeCallback(&NotifyHandoverEndOkUe));
+    LteTraceConnector traces;
+    traces.ConnectEnbRrc("ConnectionEstablished", MakeCallback(&NotifyConnectionEstablishedEnb));
+    traces.ConnectUeRrc("ConnectionEstablished", MakeCallback(&NotifyConnectionEstablishedUe));
+    traces.ConnectEnbRrc("HandoverStart", MakeCallback(&NotifyHandoverStartEnb));
+    traces.ConnectUeRrc("HandoverStart", MakeCallback(&NotifyHandoverStartUe));
+    traces.ConnectEnbRrc("HandoverEndOk", MakeCallback(&NotifyHandoverEndOkEnb));
+    traces.ConnectUeRrc("HandoverEndOk", MakeCallback(&NotifyHandoverEndOkUe));
 
     // Hook a trace sink (the same one) to the four handover failure traces                             핸드오버 실패 트레이스 싱크 연결
-    Config::Connect("/NodeList/*/DeviceList/*/LteEnbRrc/HandoverFailureNoPreamble",
-                    MakeCallback(&NotifyHandoverFailure));
-    Config::Connect("/NodeList/*/DeviceList/*/LteEnbRrc/HandoverFailureMaxRach",
-                    MakeCallback(&NotifyHandoverFailure));
-    Config::Connect("/NodeList/*/DeviceList/*/LteEnbRrc/HandoverFailureLeaving",
-                    MakeCallback(&NotifyHandoverFailure));
-    Config::Connect("/NodeList/*/DeviceList/*/LteEnbRrc/HandoverFailureJoining",
-                    MakeCallback(&NotifyHandoverFailure));
+    traces.ConnectEnbRrc("HandoverFailureNoPreamble", MakeCallback(&NotifyHandoverFailure));
+    traces.ConnectEnbRrc("HandoverFailureMaxRach", MakeCallback(&NotifyHandoverFailure));
+    traces.ConnectEnbRrc("HandoverFailureLeaving", MakeCallback(&NotifyHandoverFailure));
+    traces.ConnectEnbRrc("HandoverFailureJoining", MakeCallback(&NotifyHandoverFailure));
 
     Simulator::Stop(simTime + MilliSeconds(20));
     Simulator::Run();
+    binaryTraces.Close();
 
     // GtkConfigStore config;
     // config.ConfigureAttributes ();